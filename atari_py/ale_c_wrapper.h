@@ -2,12 +2,54 @@
 #define __ALE_C_WRAPPER_H__
 
 #include <ale_interface.hpp>
+#include <ale_vector_interface.hpp>
+#include <sstream>
+#include <string>
+#include <exception>
+
+// getScreenRGB2() converts with the standard NTSC palette regardless of the game
+static inline const ColourPalette& ntscPalette(){
+  static const ColourPalette palette = [](){
+    ColourPalette p;
+    p.setPalette("standard", "NTSC");
+    return p;
+  }();
+  return palette;
+}
+
+// Exceptions must not unwind into ctypes. The vectorized calls that can fail catch
+// them, keep the message for ALEVector_lastError() and return -1 instead.
+static inline std::string& vectorError(){
+  static thread_local std::string error;
+  return error;
+}
+
+template<class F>
+static inline int vectorCall(F f){
+  try {
+    f();
+    return 0;
+  } catch (const std::exception& e) {
+    vectorError() = e.what();
+  } catch (...) {
+    vectorError() = "unknown error";
+  }
+  return -1;
+}
 
 extern "C" {
-  // Declares int rgb_palette[256]
-  #include "atari_ntsc_rgb_palette.h"
   ALEInterface *ALE_new() {return new ALEInterface();}
   void ALE_del(ALEInterface *ale){delete ale;}
+  ALEInterface *ALE_clone(ALEInterface *ale){return ale->clone();}
+  ALEConfig *ALEConfig_new() {return new ALEConfig();}
+  void ALEConfig_del(ALEConfig *config){delete config;}
+  void ALEConfig_setString(ALEConfig *config,const char *key,const char *value){config->setString(key,value);}
+  void ALEConfig_setInt(ALEConfig *config,const char *key,int value){config->setInt(key,value);}
+  void ALEConfig_setBool(ALEConfig *config,const char *key,bool value){config->setBool(key,value);}
+  void ALEConfig_setFloat(ALEConfig *config,const char *key,float value){config->setFloat(key,value);}
+  ALEInterface *ALE_newFromMemory(const ALEConfig *config,const unsigned char *rom,size_t size,const char *rom_name){
+    return new ALEInterface(*config,rom,size,rom_name);
+  }
   const char *getString(ALEInterface *ale, const char *key){return ale->getString(key).c_str();}
   int getInt(ALEInterface *ale,const char *key) {return ale->getInt(key);}
   bool getBool(ALEInterface *ale,const char *key){return ale->getBool(key);}
@@ -22,14 +64,14 @@ extern "C" {
   void reset_game(ALEInterface *ale){ale->reset_game();}
   void getLegalActionSet(ALEInterface *ale,int *actions){
     ActionVect action_vect = ale->getLegalActionSet();
-    for(unsigned int i = 0;i < ale->getLegalActionSet().size();i++){
+    for(unsigned int i = 0;i < action_vect.size();i++){
       actions[i] = action_vect[i];
     }
   }
   int getLegalActionSize(ALEInterface *ale){return ale->getLegalActionSet().size();}
   void getMinimalActionSet(ALEInterface *ale,int *actions){
     ActionVect action_vect = ale->getMinimalActionSet();
-    for(unsigned int i = 0;i < ale->getMinimalActionSet().size();i++){
+    for(unsigned int i = 0;i < action_vect.size();i++){
       actions[i] = action_vect[i];
     }
   }
@@ -44,11 +86,11 @@ extern "C" {
     memcpy(screen_data,ale_screen_data,w*h*sizeof(pixel_t));
   }
   void getRAM(ALEInterface *ale,unsigned char *ram){
-    unsigned char *ale_ram = ale->getRAM().array();
-    int size = ale->getRAM().size();
-    memcpy(ram,ale_ram,size*sizeof(unsigned char));
+    memcpy(ram,ale->getRAMView(),RAM_SIZE*sizeof(unsigned char));
   }
-  int getRAMSize(ALEInterface *ale){return ale->getRAM().size();}
+  // The console RAM itself, valid until the next loadROM
+  const unsigned char *getRAMView(ALEInterface *ale){return ale->getRAMView();}
+  int getRAMSize(ALEInterface *ale){return RAM_SIZE;}
   int getScreenWidth(ALEInterface *ale){return ale->getScreen().width();}
   int getScreenHeight(ALEInterface *ale){return ale->getScreen().height();}
 
@@ -58,6 +100,7 @@ extern "C" {
     size_t screen_size = w*h;
     pixel_t *ale_screen_data = ale->getScreen().getArray();
 
+    ALE_PROFILE_SCOPE(ale->theOSystem->profiler(), PALETTE);
     ale->theOSystem->colourPalette().applyPaletteRGB(output_buffer, ale_screen_data, screen_size);
   }
 
@@ -67,13 +110,28 @@ extern "C" {
     size_t screen_size = w*h;
     pixel_t *ale_screen_data = ale->getScreen().getArray();
 
-    int j = 0;
-    for(int i = 0;i < screen_size;i++){
-        unsigned int zrgb = rgb_palette[ale_screen_data[i]];
-        output_buffer[j++] = (zrgb>>16)&0xff;
-        output_buffer[j++] = (zrgb>>8)&0xff;
-        output_buffer[j++] = (zrgb>>0)&0xff;
-    }
+    ALE_PROFILE_SCOPE(ale->theOSystem->profiler(), PALETTE);
+    ntscPalette().applyPaletteRGB(output_buffer, ale_screen_data, screen_size);
+  }
+
+  void getScreenRGBA(ALEInterface *ale, unsigned char *output_buffer){
+    size_t w = ale->getScreen().width();
+    size_t h = ale->getScreen().height();
+    size_t screen_size = w*h;
+    pixel_t *ale_screen_data = ale->getScreen().getArray();
+
+    ALE_PROFILE_SCOPE(ale->theOSystem->profiler(), PALETTE);
+    ale->theOSystem->colourPalette().applyPaletteRGBA(output_buffer, ale_screen_data, screen_size);
+  }
+
+  void getScreenCHW(ALEInterface *ale, unsigned char *output_buffer){
+    size_t w = ale->getScreen().width();
+    size_t h = ale->getScreen().height();
+    size_t screen_size = w*h;
+    pixel_t *ale_screen_data = ale->getScreen().getArray();
+
+    ALE_PROFILE_SCOPE(ale->theOSystem->profiler(), PALETTE);
+    ale->theOSystem->colourPalette().applyPalettePlanar(output_buffer, ale_screen_data, screen_size);
   }
 
   void getScreenGrayscale(ALEInterface *ale, unsigned char *output_buffer){
@@ -82,12 +140,72 @@ extern "C" {
     size_t screen_size = w*h;
     pixel_t *ale_screen_data = ale->getScreen().getArray();
 
+    ALE_PROFILE_SCOPE(ale->theOSystem->profiler(), PALETTE);
     ale->theOSystem->colourPalette().applyPaletteGrayscale(output_buffer, ale_screen_data, screen_size);
   }
 
+  void getObservation(ALEInterface *ale, unsigned char *output_buffer){ale->getObservation(output_buffer);}
+  int getObservationSize(ALEInterface *ale){return ale->getObservationSize();}
+
+  // Timing counters as a JSON object; the string is valid until the next call on this thread
+  const char *getProfileJSON(ALEInterface *ale){
+    static thread_local std::string json;
+    json = ale->getProfileJSON();
+    return json.c_str();
+  }
+  void resetProfile(ALEInterface *ale){ale->resetProfile();}
+
+  // Bytes used per subsystem as a JSON object; the string is valid until the next call on
+  // this thread
+  const char *getMemoryUsageJSON(ALEInterface *ale){
+    static thread_local std::string json;
+    std::map<std::string, size_t> usage = ale->getMemoryUsage();
+    std::ostringstream out;
+    out << "{";
+    for (std::map<std::string, size_t>::const_iterator it = usage.begin(); it != usage.end(); ++it)
+      out << (it == usage.begin() ? "" : ", ") << "\"" << it->first << "\": " << it->second;
+    out << "}";
+    json = out.str();
+    return json.c_str();
+  }
+
+  // Fused step: one call acts, then reports the outcome, the observation and the RAM.
+  // obs_type selects what is written to obs_buf; obs_buf and ram_buf may be NULL.
+  enum { OBS_NONE = 0, OBS_RAW = 1, OBS_RGB = 2, OBS_GRAYSCALE = 3, OBS_OBSERVATION = 4,
+         OBS_RGBA = 5, OBS_CHW = 6 };
+  struct ALEStepResult {
+    int reward;
+    bool terminal;
+    int lives;
+    int frame_number;
+    int episode_frame_number;
+  };
+  void step(ALEInterface *ale, int action, ALEStepResult *result, int obs_type,
+            unsigned char *obs_buf, unsigned char *ram_buf){
+    result->reward = ale->act((Action)action);
+    result->terminal = ale->game_over();
+    result->lives = ale->lives();
+    result->frame_number = ale->getFrameNumber();
+    result->episode_frame_number = ale->getEpisodeFrameNumber();
+
+    if(obs_buf != NULL){
+      switch(obs_type){
+        case OBS_RAW: getScreen(ale, obs_buf); break;
+        case OBS_RGB: getScreenRGB2(ale, obs_buf); break;
+        case OBS_GRAYSCALE: getScreenGrayscale(ale, obs_buf); break;
+        case OBS_OBSERVATION: getObservation(ale, obs_buf); break;
+        case OBS_RGBA: getScreenRGBA(ale, obs_buf); break;
+        case OBS_CHW: getScreenCHW(ale, obs_buf); break;
+        default: break;
+      }
+    }
+    if(ram_buf != NULL) getRAM(ale, ram_buf);
+  }
+
   void saveState(ALEInterface *ale){ale->saveState();}
   void loadState(ALEInterface *ale){ale->loadState();}
   ALEState* cloneState(ALEInterface *ale){return new ALEState(ale->cloneState());}
+  ALEState* cloneDeltaState(ALEInterface *ale, ALEState* parent){return new ALEState(ale->cloneState(*parent));}
   void restoreState(ALEInterface *ale, ALEState* state){ale->restoreState(*state);}
   ALEState* cloneSystemState(ALEInterface *ale){return new ALEState(ale->cloneSystemState());}
   void restoreSystemState(ALEInterface *ale, ALEState* state){ale->restoreSystemState(*state);}
@@ -103,6 +221,49 @@ extern "C" {
 
   // 0: Info, 1: Warning, 2: Error
   void setLoggerMode(int mode) { ale::Logger::setMode(ale::Logger::mode(mode)); }
+
+  // Vectorized interface: N environments stepped on a pool of worker threads.
+  // Screens are written as one contiguous [N, height, width] buffer of raw pixels.
+  ALEVectorInterface *ALEVector_new(int num_envs, int num_threads){return new ALEVectorInterface(num_envs, num_threads);}
+  void ALEVector_del(ALEVectorInterface *vec){delete vec;}
+  int ALEVector_size(ALEVectorInterface *vec){return vec->size();}
+  int ALEVector_numThreads(ALEVectorInterface *vec){return vec->numThreads();}
+  void ALEVector_setString(ALEVectorInterface *vec,const char *key,const char *value){vec->setString(key,value);}
+  void ALEVector_setInt(ALEVectorInterface *vec,const char *key,int value){vec->setInt(key,value);}
+  void ALEVector_setBool(ALEVectorInterface *vec,const char *key,bool value){vec->setBool(key,value);}
+  void ALEVector_setFloat(ALEVectorInterface *vec,const char *key,float value){vec->setFloat(key,value);}
+  int ALEVector_loadROM(ALEVectorInterface *vec,const char *rom_file){
+    return vectorCall([&](){vec->loadROM(rom_file);});
+  }
+  int ALEVector_act_batch(ALEVectorInterface *vec,int *actions,int *rewards,bool *terminals,unsigned char *screens){
+    return vectorCall([&](){vec->act_batch(actions,rewards,terminals,screens);});
+  }
+  int ALEVector_reset_all(ALEVectorInterface *vec,unsigned char *screens){
+    return vectorCall([&](){vec->reset_all(screens);});
+  }
+  void ALEVector_getScreens(ALEVectorInterface *vec,unsigned char *screens){vec->getScreens(screens);}
+  int ALEVector_send(ALEVectorInterface *vec,int *actions,int *env_ids,int count){
+    return vectorCall([&](){vec->send(actions,env_ids,count);});
+  }
+  int ALEVector_recv(ALEVectorInterface *vec,int batch_size){
+    int slab = -1;
+    return vectorCall([&](){slab = vec->recv(batch_size);}) < 0 ? -1 : slab;
+  }
+  int *ALEVector_slabEnvIds(ALEVectorInterface *vec,int slab){return vec->slabEnvIds(slab);}
+  int *ALEVector_slabRewards(ALEVectorInterface *vec,int slab){return vec->slabRewards(slab);}
+  bool *ALEVector_slabTerminals(ALEVectorInterface *vec,int slab){return vec->slabTerminals(slab);}
+  unsigned char *ALEVector_slabScreens(ALEVectorInterface *vec,int slab){return vec->slabScreens(slab);}
+  int ALEVector_getScreenWidth(ALEVectorInterface *vec){return vec->getScreenWidth();}
+  int ALEVector_getScreenHeight(ALEVectorInterface *vec){return vec->getScreenHeight();}
+  void ALEVector_getMinimalActionSet(ALEVectorInterface *vec,int *actions){
+    ActionVect action_vect = vec->getMinimalActionSet();
+    for(unsigned int i = 0;i < action_vect.size();i++){
+      actions[i] = action_vect[i];
+    }
+  }
+  int ALEVector_getMinimalActionSize(ALEVectorInterface *vec){return vec->getMinimalActionSet().size();}
+  ALEInterface *ALEVector_getEnv(ALEVectorInterface *vec,int i){return &vec->getEnv(i);}
+  const char *ALEVector_lastError(){return vectorError().c_str();}
 }
 
 #endif
@@ -0,0 +1,205 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  aleBench.cpp
+ *
+ *  Throughput of every supported ROM in a directory, under each combination of
+ *  CPU emulation, fast TIA updates and colour averaging. Results are written as
+ *  JSON, one record per ROM and configuration, for comparing builds.
+ *
+ *  Usage: ale_bench rom_dir [output_file] [frames]
+ **************************************************************************** */
+
+#include <ale_interface.hpp>
+#include <FSNode.hxx>
+#include <Roms.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Config {
+  const char* cpu;
+  bool fast_tia_update;
+  bool color_averaging;
+};
+
+struct Result {
+  double frames_per_sec;
+  double steps_per_sec;
+  double reset_us;
+  double clone_state_us;
+  double restore_state_us;
+  double clone_system_state_us;
+  size_t encoded_state_bytes;
+};
+
+static double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/** Plays `frames` frames with frame_skip set to `frame_skip`; returns the acts per second */
+static double timeActs(const std::string& rom_file, const Config& config, int frame_skip,
+                       int frames, double* frames_per_sec) {
+  ALEInterface ale;
+  ale.setInt("random_seed", 123);
+  ale.setFloat("repeat_action_probability", 0.0);
+  ale.setString("cpu", config.cpu);
+  ale.setBool("fast_tia_update", config.fast_tia_update);
+  ale.setBool("color_averaging", config.color_averaging);
+  ale.setInt("frame_skip", frame_skip);
+  ale.loadROM(rom_file);
+
+  ActionVect actions = ale.getMinimalActionSet();
+  int steps = frames / frame_skip;
+  int start_frame = ale.getFrameNumber();
+  Clock::time_point start = Clock::now();
+  for (int t = 0; t < steps; t++) {
+    ale.act(actions[t % actions.size()]);
+    if (ale.game_over()) ale.reset_game();
+  }
+  double seconds = secondsSince(start);
+
+  // Resets emulate frames too, so count what actually ran
+  if (frames_per_sec) *frames_per_sec = (ale.getFrameNumber() - start_frame) / seconds;
+  return steps / seconds;
+}
+
+static void timeStates(const std::string& rom_file, const Config& config, int iterations,
+                       Result& result) {
+  ALEInterface ale;
+  ale.setInt("random_seed", 123);
+  ale.setFloat("repeat_action_probability", 0.0);
+  ale.setString("cpu", config.cpu);
+  ale.setBool("fast_tia_update", config.fast_tia_update);
+  ale.setBool("color_averaging", config.color_averaging);
+  ale.loadROM(rom_file);
+
+  // Resets are slow enough that a handful of them suffice
+  int resets = iterations / 100 + 1;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < resets; i++) {
+    ale.reset_game();
+  }
+  result.reset_us = secondsSince(start) * 1e6 / resets;
+
+  // Play a little so the state is not the power-on state
+  ActionVect actions = ale.getMinimalActionSet();
+  for (int t = 0; t < 200; t++) {
+    ale.act(actions[t % actions.size()]);
+    if (ale.game_over()) ale.reset_game();
+  }
+
+  ALEState state = ale.cloneState();
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    state = ale.cloneState();
+  }
+  result.clone_state_us = secondsSince(start) * 1e6 / iterations;
+
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    ale.restoreState(state);
+  }
+  result.restore_state_us = secondsSince(start) * 1e6 / iterations;
+
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    state = ale.cloneSystemState();
+  }
+  result.clone_system_state_us = secondsSince(start) * 1e6 / iterations;
+
+  result.encoded_state_bytes = ale.cloneState().serialize().size();
+}
+
+/** The supported ROMs in rom_dir, in name order */
+static std::vector<std::string> findRoms(const std::string& rom_dir) {
+  std::vector<std::string> roms;
+  FilesystemNode dir(rom_dir);
+  if (!dir.isDirectory()) return roms;
+
+  FSList files = dir.listDir(FilesystemNode::kListFilesOnly);
+  files.sort();
+  for (unsigned int i = 0; i < files.size(); i++) {
+    RomSettings* settings = buildRomRLWrapper(files[i].path());
+    if (settings == NULL) continue;
+    delete settings;
+    roms.push_back(files[i].path());
+  }
+  return roms;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s rom_dir [output_file] [frames]\n", argv[0]);
+    return 1;
+  }
+  FILE* out = stdout;
+  if (argc > 2 && std::string(argv[2]) != "-") {
+    out = fopen(argv[2], "w");
+    if (out == NULL) {
+      fprintf(stderr, "Cannot open %s\n", argv[2]);
+      return 1;
+    }
+  }
+  int frames = argc > 3 ? atoi(argv[3]) : 4000;
+
+  std::vector<std::string> roms = findRoms(argv[1]);
+  if (roms.empty()) {
+    fprintf(stderr, "No supported ROMs in %s\n", argv[1]);
+    return 1;
+  }
+
+  std::vector<Config> configs;
+  const char* cpus[] = { "low", "high" };
+  for (int c = 0; c < 2; c++) {
+    for (int fast = 0; fast < 2; fast++) {
+      for (int averaging = 0; averaging < 2; averaging++) {
+        Config config = { cpus[c], fast != 0, averaging != 0 };
+        configs.push_back(config);
+      }
+    }
+  }
+
+  ale::Logger::setMode(ale::Logger::Error);
+  fprintf(out, "{\"frames\":%d,\"results\":[", frames);
+  for (size_t r = 0; r < roms.size(); r++) {
+    std::string name = FilesystemNode(roms[r]).displayName();
+    name = name.substr(0, name.find_first_of("."));
+    fprintf(stderr, "%s\n", name.c_str());
+
+    for (size_t c = 0; c < configs.size(); c++) {
+      const Config& config = configs[c];
+      Result result;
+      timeActs(roms[r], config, 1, frames, &result.frames_per_sec);
+      result.steps_per_sec = timeActs(roms[r], config, 4, frames, NULL);
+      timeStates(roms[r], config, frames * 5, result);
+
+      fprintf(out, "%s\n{\"rom\":\"%s\",\"cpu\":\"%s\",\"fast_tia_update\":%s,"
+              "\"color_averaging\":%s,\"frames_per_sec\":%.1f,\"steps_per_sec\":%.1f,"
+              "\"reset_us\":%.2f,\"clone_state_us\":%.3f,\"restore_state_us\":%.3f,"
+              "\"clone_system_state_us\":%.3f,\"encoded_state_bytes\":%lu}",
+              r + c > 0 ? "," : "", name.c_str(), config.cpu,
+              config.fast_tia_update ? "true" : "false",
+              config.color_averaging ? "true" : "false", result.frames_per_sec,
+              result.steps_per_sec, result.reset_us, result.clone_state_us,
+              result.restore_state_us, result.clone_system_state_us,
+              (unsigned long)result.encoded_state_bytes);
+      fflush(out);
+    }
+  }
+  fprintf(out, "\n]}\n");
+
+  if (out != stdout) fclose(out);
+  return 0;
+}
@@ -0,0 +1,119 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  paletteBenchmark.cpp
+ *
+ *  Measures the palette conversion kernels on screens of a game, comparing the
+ *  kernels selected for this CPU against the portable ones.
+ *
+ *  Usage: paletteBenchmark rom_file [iterations]
+ **************************************************************************** */
+
+#include <ale_interface.hpp>
+#include <PaletteKernels.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Tables {
+  uInt8 red[256], green[256], blue[256], gray[256];
+};
+
+enum Layout { GRAYSCALE, RGB, RGBA, CHW };
+static const char* LAYOUT_NAMES[] = { "grayscale", "rgb", "rgba", "chw" };
+static const int LAYOUT_CHANNELS[] = { 1, 3, 4, 3 };
+
+static void convert(const PaletteKernels& kernels, const Tables& t, Layout layout,
+                    const uInt8* src, uInt8* dst, size_t size) {
+  switch (layout) {
+    case GRAYSCALE: kernels.lookup(t.gray, src, dst, size); break;
+    case RGB: kernels.lookupRGB(t.red, t.green, t.blue, src, dst, size); break;
+    case RGBA: kernels.lookupRGBA(t.red, t.green, t.blue, src, dst, size); break;
+    case CHW:
+      kernels.lookup(t.red, src, dst, size);
+      kernels.lookup(t.green, src, dst + size, size);
+      kernels.lookup(t.blue, src, dst + 2 * size, size);
+      break;
+  }
+}
+
+/** Returns the time per screen in microseconds */
+static double timeKernels(const PaletteKernels& kernels, const Tables& t, Layout layout,
+                          const std::vector<std::vector<uInt8> >& screens, uInt8* dst,
+                          int iterations) {
+  size_t size = screens[0].size();
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    convert(kernels, t, layout, &screens[i % screens.size()][0], dst, size);
+  }
+  return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s rom_file [iterations]\n", argv[0]);
+    return 1;
+  }
+  int iterations = argc > 2 ? atoi(argv[2]) : 20000;
+
+  ale::Logger::setMode(ale::Logger::Error);
+  ALEInterface ale;
+  ale.setInt("random_seed", 123);
+  ale.loadROM(argv[1]);
+
+  // A few hundred screens of actual play
+  std::vector<std::vector<uInt8> > screens;
+  ActionVect actions = ale.getMinimalActionSet();
+  for (int t = 0; t < 1000; t++) {
+    ale.act(actions[t % actions.size()]);
+    if (ale.game_over()) ale.reset_game();
+    if (t % 4 == 0) {
+      const ALEScreen& screen = ale.getScreen();
+      screens.push_back(std::vector<uInt8>(screen.getArray(), screen.getArray() + screen.arraySize()));
+    }
+  }
+
+  Tables t;
+  const ColourPalette& palette = ale.theOSystem->colourPalette();
+  for (int i = 0; i < 256; i++) {
+    uInt32 rgb = palette.getRGB(i);
+    t.red[i] = (rgb >> 16) & 0xFF;
+    t.green[i] = (rgb >> 8) & 0xFF;
+    t.blue[i] = rgb & 0xFF;
+    t.gray[i] = palette.getRGB(i | 1) & 0xFF;
+  }
+
+  const PaletteKernels& portable = PaletteKernels::portable();
+  const PaletteKernels& best = PaletteKernels::best();
+  size_t size = screens[0].size();
+  std::vector<uInt8> expected(4 * size), actual(4 * size);
+
+  printf("%-10s %12s %12s %8s\n", "layout", portable.name, best.name, "speedup");
+  for (int layout = GRAYSCALE; layout <= CHW; layout++) {
+    size_t out_size = LAYOUT_CHANNELS[layout] * size;
+    for (size_t s = 0; s < screens.size(); s++) {
+      convert(portable, t, (Layout)layout, &screens[s][0], &expected[0], size);
+      convert(best, t, (Layout)layout, &screens[s][0], &actual[0], size);
+      if (memcmp(&expected[0], &actual[0], out_size) != 0) {
+        fprintf(stderr, "%s kernels disagree on %s\n", best.name, LAYOUT_NAMES[layout]);
+        return 1;
+      }
+    }
+
+    double portable_us = timeKernels(portable, t, (Layout)layout, screens, &actual[0], iterations);
+    double best_us = timeKernels(best, t, (Layout)layout, screens, &actual[0], iterations);
+    printf("%-10s %9.2f us %9.2f us %7.1fx\n", LAYOUT_NAMES[layout], portable_us, best_us,
+           portable_us / best_us);
+  }
+  return 0;
+}
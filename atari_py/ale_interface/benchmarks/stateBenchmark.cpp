@@ -0,0 +1,79 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  stateBenchmark.cpp
+ *
+ *  Measures the size and the clone/restore latency of emulator states in the
+ *  portable and the compact format, stored in full or as deltas.
+ *
+ *  Usage: stateBenchmark rom_file [iterations]
+ **************************************************************************** */
+
+#include <ale_interface.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+typedef std::chrono::steady_clock Clock;
+
+static void timeCloneRestore(ALEInterface& ale, const char* label, const ALEState* parent,
+                             int iterations) {
+  ALEState state = parent ? ale.cloneState(*parent) : ale.cloneState();
+
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    state = parent ? ale.cloneState(*parent) : ale.cloneState();
+  }
+  double clone_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+  start = Clock::now();
+  for (int i = 0; i < iterations; i++) {
+    ale.restoreState(state);
+  }
+  double restore_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+  printf("%-15s %8lu bytes %10.2f us/clone %10.2f us/restore\n", label,
+         (unsigned long)state.storageSize(), clone_us / iterations, restore_us / iterations);
+}
+
+static void benchmark(const char* rom_file, bool compact, int iterations) {
+  ALEInterface ale;
+  ale.setInt("random_seed", 123);
+  ale.setBool("compact_state", compact);
+  ale.loadROM(rom_file);
+
+  // Play a little so the state is not the power-on state
+  ActionVect actions = ale.getMinimalActionSet();
+  for (int t = 0; t < 500; t++) {
+    ale.act(actions[t % actions.size()]);
+    if (ale.game_over()) ale.reset_game();
+  }
+  timeCloneRestore(ale, compact ? "compact" : "portable", NULL, iterations);
+
+  // Deltas of a tree node a few frames up, as a planner would store them
+  ALEState parent = ale.cloneState();
+  for (int t = 0; t < 4; t++) {
+    ale.act(actions[t % actions.size()]);
+  }
+  timeCloneRestore(ale, compact ? "compact delta" : "portable delta", &parent, iterations);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s rom_file [iterations]\n", argv[0]);
+    return 1;
+  }
+  int iterations = argc > 2 ? atoi(argv[2]) : 100000;
+
+  ale::Logger::setMode(ale::Logger::Error);
+  benchmark(argv[1], false, iterations);
+  benchmark(argv[1], true, iterations);
+  return 0;
+}
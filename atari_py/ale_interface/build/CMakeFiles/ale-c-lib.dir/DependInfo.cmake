@@ -0,0 +1,166 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/atari_py/ale_interface/src/emucore/unzip.c" "CMakeFiles/ale-c-lib.dir/src/emucore/unzip.c.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/unzip.c.o.d"
+  "/root/repo/atari_py/ale_interface/src/external/TinyMT/tinymt32.c" "CMakeFiles/ale-c-lib.dir/src/external/TinyMT/tinymt32.c.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/external/TinyMT/tinymt32.c.o.d"
+  "/root/repo/atari_py/ale_c_wrapper.cpp" "CMakeFiles/ale-c-lib.dir/root/repo/atari_py/ale_c_wrapper.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/root/repo/atari_py/ale_c_wrapper.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/ale_interface.cpp" "CMakeFiles/ale-c-lib.dir/src/ale_interface.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/ale_interface.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/ale_vector_interface.cpp" "CMakeFiles/ale-c-lib.dir/src/ale_vector_interface.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/ale_vector_interface.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/ColourPalette.cpp" "CMakeFiles/ale-c-lib.dir/src/common/ColourPalette.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/ColourPalette.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/Constants.cpp" "CMakeFiles/ale-c-lib.dir/src/common/Constants.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/Constants.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/Log.cpp" "CMakeFiles/ale-c-lib.dir/src/common/Log.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/Log.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/PaletteKernels.cpp" "CMakeFiles/ale-c-lib.dir/src/common/PaletteKernels.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/PaletteKernels.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/Profiler.cpp" "CMakeFiles/ale-c-lib.dir/src/common/Profiler.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/Profiler.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/ScreenExporter.cpp" "CMakeFiles/ale-c-lib.dir/src/common/ScreenExporter.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/ScreenExporter.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/SoundExporter.cpp" "CMakeFiles/ale-c-lib.dir/src/common/SoundExporter.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/SoundExporter.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/SoundNull.cxx" "CMakeFiles/ale-c-lib.dir/src/common/SoundNull.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/SoundNull.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/SoundSDL.cxx" "CMakeFiles/ale-c-lib.dir/src/common/SoundSDL.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/SoundSDL.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/ThreadPool.cpp" "CMakeFiles/ale-c-lib.dir/src/common/ThreadPool.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/ThreadPool.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/common/display_screen.cpp" "CMakeFiles/ale-c-lib.dir/src/common/display_screen.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/common/display_screen.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/controllers/ale_controller.cpp" "CMakeFiles/ale-c-lib.dir/src/controllers/ale_controller.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/controllers/ale_controller.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/controllers/fifo_controller.cpp" "CMakeFiles/ale-c-lib.dir/src/controllers/fifo_controller.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/controllers/fifo_controller.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/controllers/rlglue_controller.cpp" "CMakeFiles/ale-c-lib.dir/src/controllers/rlglue_controller.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/controllers/rlglue_controller.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/AtariVox.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/AtariVox.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/AtariVox.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Booster.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Booster.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Booster.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart0840.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart0840.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart0840.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart2K.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart2K.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart2K.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart3E.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3E.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3E.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart3F.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3F.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3F.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart4A50.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4A50.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4A50.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Cart4K.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4K.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4K.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartAR.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartAR.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartAR.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartCV.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartCV.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartCV.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartDPC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartDPC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartDPC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartE0.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartE0.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartE0.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartE7.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartE7.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartE7.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF4.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF4SC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4SC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4SC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF6.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF6SC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6SC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6SC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF8.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartF8SC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8SC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8SC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartFASC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartFASC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartFASC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartFE.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartFE.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartFE.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartMB.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartMB.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartMB.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartMC.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartMC.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartMC.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/CartUA.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/CartUA.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/CartUA.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Console.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Console.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Console.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Control.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Control.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Control.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Deserializer.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Deserializer.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Deserializer.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Driving.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Driving.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Driving.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Event.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Event.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Event.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/FSNode.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/FSNode.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/FSNode.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Joystick.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Joystick.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Joystick.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Keyboard.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Keyboard.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Keyboard.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/M6532.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/M6532.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/M6532.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/MD5.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/MD5.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/MD5.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/MediaSrc.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/MediaSrc.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/MediaSrc.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/OSystem.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/OSystem.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/OSystem.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Paddles.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Paddles.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Paddles.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Props.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Props.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Props.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/PropsSet.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/PropsSet.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/PropsSet.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Random.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Random.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Random.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/RomImage.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/RomImage.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/RomImage.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Serializer.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Serializer.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Serializer.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Settings.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Settings.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Settings.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/SpeakJet.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/SpeakJet.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/SpeakJet.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/Switches.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/Switches.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/Switches.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/TIA.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/TIA.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/TIA.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/TIASnd.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/TIASnd.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/TIASnd.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/Device.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/Device.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/Device.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/M6502.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/M6502Block.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Block.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Block.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/M6502Fast.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Fast.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Fast.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/M6502Hi.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Hi.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Hi.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/M6502Low.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Low.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Low.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/NullDev.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/NullDev.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/NullDev.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/emucore/m6502/src/System.cxx" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/System.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/System.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/environment/ale_state.cpp" "CMakeFiles/ale-c-lib.dir/src/environment/ale_state.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/environment/ale_state.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/environment/observation_pipeline.cpp" "CMakeFiles/ale-c-lib.dir/src/environment/observation_pipeline.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/environment/observation_pipeline.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/environment/phosphor_blend.cpp" "CMakeFiles/ale-c-lib.dir/src/environment/phosphor_blend.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/environment/phosphor_blend.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/environment/stella_environment.cpp" "CMakeFiles/ale-c-lib.dir/src/environment/stella_environment.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/environment/stella_environment.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/RomSettings.cpp" "CMakeFiles/ale-c-lib.dir/src/games/RomSettings.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/RomSettings.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/RomUtils.cpp" "CMakeFiles/ale-c-lib.dir/src/games/RomUtils.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/RomUtils.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/Roms.cpp" "CMakeFiles/ale-c-lib.dir/src/games/Roms.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/Roms.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Adventure.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Adventure.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Adventure.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/AirRaid.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/AirRaid.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/AirRaid.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Alien.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Alien.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Alien.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Amidar.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Amidar.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Amidar.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Assault.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Assault.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Assault.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Asterix.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Asterix.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Asterix.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Asteroids.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Asteroids.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Asteroids.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Atlantis.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Atlantis.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Atlantis.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/BankHeist.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/BankHeist.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/BankHeist.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/BattleZone.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/BattleZone.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/BattleZone.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/BeamRider.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/BeamRider.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/BeamRider.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Berzerk.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Berzerk.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Berzerk.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Bowling.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Bowling.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Bowling.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Boxing.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Boxing.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Boxing.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Breakout.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Breakout.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Breakout.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Carnival.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Carnival.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Carnival.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Centipede.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Centipede.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Centipede.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/ChopperCommand.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/ChopperCommand.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/ChopperCommand.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/CrazyClimber.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/CrazyClimber.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/CrazyClimber.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Defender.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Defender.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Defender.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/DemonAttack.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/DemonAttack.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/DemonAttack.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/DoubleDunk.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/DoubleDunk.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/DoubleDunk.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/ElevatorAction.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/ElevatorAction.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/ElevatorAction.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Enduro.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Enduro.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Enduro.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/FishingDerby.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/FishingDerby.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/FishingDerby.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Freeway.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Freeway.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Freeway.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Frostbite.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Frostbite.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Frostbite.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Gopher.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Gopher.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Gopher.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Gravitar.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Gravitar.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Gravitar.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Hero.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Hero.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Hero.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/IceHockey.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/IceHockey.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/IceHockey.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/JamesBond.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/JamesBond.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/JamesBond.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/JourneyEscape.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/JourneyEscape.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/JourneyEscape.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Kaboom.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Kaboom.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Kaboom.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Kangaroo.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Kangaroo.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Kangaroo.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Krull.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Krull.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Krull.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/KungFuMaster.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/KungFuMaster.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/KungFuMaster.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/MontezumaRevenge.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/MontezumaRevenge.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/MontezumaRevenge.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/MsPacman.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/MsPacman.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/MsPacman.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/NameThisGame.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/NameThisGame.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/NameThisGame.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Phoenix.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Phoenix.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Phoenix.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Pitfall.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pitfall.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pitfall.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Pong.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pong.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pong.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Pooyan.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pooyan.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Pooyan.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/PrivateEye.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/PrivateEye.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/PrivateEye.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/QBert.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/QBert.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/QBert.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/RiverRaid.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/RiverRaid.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/RiverRaid.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/RoadRunner.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/RoadRunner.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/RoadRunner.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/RoboTank.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/RoboTank.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/RoboTank.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Seaquest.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Seaquest.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Seaquest.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Skiing.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Skiing.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Skiing.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Solaris.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Solaris.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Solaris.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/SpaceInvaders.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/SpaceInvaders.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/SpaceInvaders.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/StarGunner.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/StarGunner.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/StarGunner.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Tennis.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Tennis.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Tennis.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/TimePilot.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/TimePilot.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/TimePilot.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Tutankham.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Tutankham.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Tutankham.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/UpNDown.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/UpNDown.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/UpNDown.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Venture.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Venture.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Venture.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/VideoPinball.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/VideoPinball.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/VideoPinball.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/WizardOfWor.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/WizardOfWor.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/WizardOfWor.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/YarsRevenge.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/YarsRevenge.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/YarsRevenge.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/games/supported/Zaxxon.cpp" "CMakeFiles/ale-c-lib.dir/src/games/supported/Zaxxon.cpp.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/games/supported/Zaxxon.cpp.o.d"
+  "/root/repo/atari_py/ale_interface/src/os_dependent/FSNodePOSIX.cxx" "CMakeFiles/ale-c-lib.dir/src/os_dependent/FSNodePOSIX.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/os_dependent/FSNodePOSIX.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/os_dependent/OSystemUNIX.cxx" "CMakeFiles/ale-c-lib.dir/src/os_dependent/OSystemUNIX.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/os_dependent/OSystemUNIX.cxx.o.d"
+  "/root/repo/atari_py/ale_interface/src/os_dependent/SettingsUNIX.cxx" "CMakeFiles/ale-c-lib.dir/src/os_dependent/SettingsUNIX.cxx.o" "gcc" "CMakeFiles/ale-c-lib.dir/src/os_dependent/SettingsUNIX.cxx.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,305 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ale-c-lib.dir/root/repo/atari_py/ale_c_wrapper.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/root/repo/atari_py/ale_c_wrapper.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/ale_interface.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/ale_interface.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/ale_vector_interface.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/ale_vector_interface.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/ColourPalette.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/ColourPalette.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/Constants.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/Constants.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/Log.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/Log.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/PaletteKernels.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/PaletteKernels.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/Profiler.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/Profiler.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/ScreenExporter.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/ScreenExporter.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundExporter.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundExporter.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundNull.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundNull.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundSDL.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/SoundSDL.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/ThreadPool.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/ThreadPool.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/common/display_screen.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/common/display_screen.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/ale_controller.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/ale_controller.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/fifo_controller.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/fifo_controller.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/rlglue_controller.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/controllers/rlglue_controller.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/AtariVox.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/AtariVox.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Booster.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Booster.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart0840.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart0840.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart2K.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart2K.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3E.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3E.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3F.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart3F.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4A50.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4A50.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4K.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Cart4K.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartAR.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartAR.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartCV.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartCV.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartDPC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartDPC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartE0.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartE0.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartE7.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartE7.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4SC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF4SC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6SC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF6SC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8SC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartF8SC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartFASC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartFASC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartFE.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartFE.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartMB.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartMB.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartMC.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartMC.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartUA.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/CartUA.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Console.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Console.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Control.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Control.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Deserializer.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Deserializer.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Driving.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Driving.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Event.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Event.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/FSNode.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/FSNode.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Joystick.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Joystick.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Keyboard.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Keyboard.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/M6532.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/M6532.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/MD5.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/MD5.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/MediaSrc.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/MediaSrc.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/OSystem.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/OSystem.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Paddles.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Paddles.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Props.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Props.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/PropsSet.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/PropsSet.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Random.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Random.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/RomImage.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/RomImage.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Serializer.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Serializer.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Settings.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Settings.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/SpeakJet.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/SpeakJet.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Switches.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/Switches.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/TIA.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/TIA.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/TIASnd.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/TIASnd.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/Device.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/Device.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Block.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Block.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Fast.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Fast.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Hi.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Hi.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Low.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/M6502Low.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/NullDev.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/NullDev.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/System.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/m6502/src/System.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/unzip.c.o"
+  "CMakeFiles/ale-c-lib.dir/src/emucore/unzip.c.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/environment/ale_state.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/environment/ale_state.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/environment/observation_pipeline.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/environment/observation_pipeline.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/environment/phosphor_blend.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/environment/phosphor_blend.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/environment/stella_environment.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/environment/stella_environment.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/external/TinyMT/tinymt32.c.o"
+  "CMakeFiles/ale-c-lib.dir/src/external/TinyMT/tinymt32.c.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/RomSettings.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/RomSettings.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/RomUtils.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/RomUtils.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/Roms.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/Roms.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Adventure.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Adventure.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/AirRaid.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/AirRaid.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Alien.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Alien.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Amidar.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Amidar.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Assault.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Assault.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Asterix.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Asterix.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Asteroids.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Asteroids.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Atlantis.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Atlantis.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BankHeist.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BankHeist.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BattleZone.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BattleZone.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BeamRider.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/BeamRider.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Berzerk.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Berzerk.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Bowling.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Bowling.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Boxing.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Boxing.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Breakout.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Breakout.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Carnival.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Carnival.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Centipede.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Centipede.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/ChopperCommand.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/ChopperCommand.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/CrazyClimber.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/CrazyClimber.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Defender.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Defender.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/DemonAttack.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/DemonAttack.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/DoubleDunk.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/DoubleDunk.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/ElevatorAction.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/ElevatorAction.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Enduro.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Enduro.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/FishingDerby.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/FishingDerby.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Freeway.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Freeway.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Frostbite.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Frostbite.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Gopher.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Gopher.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Gravitar.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Gravitar.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Hero.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Hero.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/IceHockey.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/IceHockey.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/JamesBond.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/JamesBond.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/JourneyEscape.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/JourneyEscape.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Kaboom.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Kaboom.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Kangaroo.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Kangaroo.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Krull.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Krull.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/KungFuMaster.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/KungFuMaster.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/MontezumaRevenge.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/MontezumaRevenge.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/MsPacman.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/MsPacman.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/NameThisGame.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/NameThisGame.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Phoenix.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Phoenix.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pitfall.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pitfall.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pong.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pong.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pooyan.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Pooyan.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/PrivateEye.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/PrivateEye.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/QBert.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/QBert.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RiverRaid.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RiverRaid.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RoadRunner.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RoadRunner.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RoboTank.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/RoboTank.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Seaquest.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Seaquest.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Skiing.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Skiing.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Solaris.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Solaris.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/SpaceInvaders.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/SpaceInvaders.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/StarGunner.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/StarGunner.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Tennis.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Tennis.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/TimePilot.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/TimePilot.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Tutankham.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Tutankham.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/UpNDown.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/UpNDown.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Venture.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Venture.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/VideoPinball.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/VideoPinball.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/WizardOfWor.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/WizardOfWor.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/YarsRevenge.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/YarsRevenge.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Zaxxon.cpp.o"
+  "CMakeFiles/ale-c-lib.dir/src/games/supported/Zaxxon.cpp.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/FSNodePOSIX.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/FSNodePOSIX.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/OSystemUNIX.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/OSystemUNIX.cxx.o.d"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/SettingsUNIX.cxx.o"
+  "CMakeFiles/ale-c-lib.dir/src/os_dependent/SettingsUNIX.cxx.o.d"
+  "libale_c.pdb"
+  "libale_c.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/ale-c-lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -28,8 +28,14 @@
  *  The shared library interface.
  **************************************************************************** */
 #include "ale_interface.hpp"
+#include "emucore/m6502/src/System.hxx"
+#include "emucore/m6502/src/M6502.hxx"
+#include "emucore/Cart.hxx"
+#include "emucore/M6532.hxx"
+#include "emucore/TIA.hxx"
 #include <stdexcept>
 #include <ctime>
+#include <mutex>
 
 using namespace std;
 using namespace ale;
@@ -43,7 +49,7 @@ std::string ALEInterface::welcomeMessage() {
   return oss.str();
 }
 
-void ALEInterface::disableBufferedIO() {
+static void disableBufferedIOOnce() {
   setvbuf(stdout, NULL, _IONBF, 0);
   setvbuf(stdin, NULL, _IONBF, 0);
   cin.rdbuf()->pubsetbuf(0,0);
@@ -52,8 +58,39 @@ void ALEInterface::disableBufferedIO() {
   cout.sync_with_stdio();
 }
 
-void ALEInterface::createOSystem(std::auto_ptr<OSystem> &theOSystem,
-                          std::auto_ptr<Settings> &theSettings) {
+// The standard streams are process-wide, so only the first interface
+// (possibly one of several created concurrently) reconfigures them.
+void ALEInterface::disableBufferedIO() {
+  static std::once_flag done;
+  std::call_once(done, disableBufferedIOOnce);
+}
+
+void ALEConfig::setString(const std::string& key, const std::string& value) {
+  m_strings.push_back(std::make_pair(key, value));
+}
+void ALEConfig::setInt(const std::string& key, const int value) {
+  m_ints.push_back(std::make_pair(key, value));
+}
+void ALEConfig::setBool(const std::string& key, const bool value) {
+  m_bools.push_back(std::make_pair(key, value));
+}
+void ALEConfig::setFloat(const std::string& key, const float value) {
+  m_floats.push_back(std::make_pair(key, value));
+}
+
+void ALEConfig::apply(Settings& settings) const {
+  for (size_t i = 0; i < m_strings.size(); i++)
+    settings.setString(m_strings[i].first, m_strings[i].second);
+  for (size_t i = 0; i < m_ints.size(); i++)
+    settings.setInt(m_ints[i].first, m_ints[i].second);
+  for (size_t i = 0; i < m_bools.size(); i++)
+    settings.setBool(m_bools[i].first, m_bools[i].second);
+  for (size_t i = 0; i < m_floats.size(); i++)
+    settings.setFloat(m_floats[i].first, m_floats[i].second);
+}
+
+void ALEInterface::newOSystem(std::auto_ptr<OSystem> &theOSystem,
+                              std::auto_ptr<Settings> &theSettings) {
 #if (defined(WIN32) || defined(__MINGW32__))
   theOSystem.reset(new OSystemWin32());
   theSettings.reset(new SettingsWin32(theOSystem.get()));
@@ -61,7 +98,11 @@ void ALEInterface::createOSystem(std::auto_ptr<OSystem> &theOSystem,
   theOSystem.reset(new OSystemUNIX());
   theSettings.reset(new SettingsUNIX(theOSystem.get()));
 #endif
+}
 
+void ALEInterface::createOSystem(std::auto_ptr<OSystem> &theOSystem,
+                          std::auto_ptr<Settings> &theSettings) {
+  newOSystem(theOSystem, theSettings);
   theOSystem->settings().loadConfig();
 }
 
@@ -111,6 +152,37 @@ ALEInterface::ALEInterface(bool display_screen) {
   this->setBool("display_screen", display_screen);
 }
 
+ALEInterface::ALEInterface(const ALEConfig& config, const uint8_t* rom, size_t size,
+                           const std::string& rom_name) {
+  disableBufferedIO();
+  Logger::Info << welcomeMessage() << std::endl;
+  newOSystem(theOSystem, theSettings);
+  config.apply(*theSettings);
+  loadROM(rom, size, rom_name);
+}
+
+ALEInterface::ALEInterface(const ALEInterface& other) {
+  newOSystem(theOSystem, theSettings);
+  theSettings->copy(*other.theSettings);
+  m_rom_image = other.m_rom_image;
+  if (!other.environment.get())
+    return;
+
+  // The console plays the cartridge the other one made from the ROM image
+  theOSystem->create();
+  if (!theOSystem->createConsole(other.theOSystem->console()))
+    throw std::runtime_error("Failed to clone the console");
+  theOSystem->colourPalette().setPalette("standard", theOSystem->console().getFormat());
+
+  romSettings.reset(other.romSettings->clone());
+  environment.reset(other.environment->clone(theOSystem.get(), romSettings.get()));
+  max_num_frames = other.max_num_frames;
+}
+
+ALEInterface* ALEInterface::clone() const {
+  return new ALEInterface(*this);
+}
+
 ALEInterface::~ALEInterface() {}
 
 // Loads and initializes a game. After this call the game should be
@@ -121,11 +193,48 @@ void ALEInterface::loadROM(string rom_file = "") {
   assert(theOSystem.get());
   if (rom_file.empty()) {
     rom_file = theOSystem->romFile();
+    if (m_rom_image.get()) {
+      loadROM(m_rom_image, rom_file);
+      return;
+    }
   }
   loadSettings(rom_file, theOSystem);
-  romSettings.reset(buildRomRLWrapper(rom_file));
+  m_rom_image.reset();
+  createEnvironment(rom_file);
+}
+
+void ALEInterface::loadROM(const uint8_t* rom, size_t size, const std::string& rom_name) {
+  assert(theOSystem.get());
+  std::shared_ptr<const RomImage> image;
+  if (size > 0)
+    image = RomImage::open(rom, size, rom_name);
+  if (!image.get())
+    throw std::runtime_error("Invalid ROM image for " + rom_name);
+  loadROM(image, rom_name);
+  m_rom_image = image;
+}
+
+void ALEInterface::loadROM(const std::shared_ptr<const RomImage>& image,
+                           const std::string& rom_name) {
+  theOSystem->settings().validate();
+  theOSystem->create();
+  if (!theOSystem->createConsole(image, rom_name))
+    throw std::runtime_error("Failed to create a console for " + rom_name);
+  theOSystem->settings().setString("rom_file", rom_name);
+
+  Logger::Info << "Random seed is " << theOSystem->settings().getInt("random_seed") << std::endl;
+  theOSystem->resetRNGSeed();
+  theOSystem->colourPalette().setPalette("standard", theOSystem->console().getFormat());
+
+  createEnvironment(rom_name);
+}
+
+void ALEInterface::createEnvironment(const std::string& rom_name) {
+  romSettings.reset(buildRomRLWrapper(rom_name));
+  if (!romSettings.get())
+    throw std::runtime_error("Unsupported ROM: " + rom_name);
   environment.reset(new StellaEnvironment(theOSystem.get(), romSettings.get()));
-  max_num_frames = theOSystem->settings().getInt("max_num_frames_per_episode");
+  max_num_frames = theOSystem->settings().maxNumFramesPerEpisode();
   environment->reset();
 #ifndef __USE_SDL
   if (theOSystem->p_display_screen != NULL) {
@@ -160,25 +269,21 @@ void ALEInterface::setString(const string& key, const string& value) {
   assert(theSettings.get());
   assert(theOSystem.get());
   theSettings->setString(key, value);
-  theSettings->validate();
 }
 void ALEInterface::setInt(const string& key, const int value) {
   assert(theSettings.get());
   assert(theOSystem.get());
   theSettings->setInt(key, value);
-  theSettings->validate();
 }
 void ALEInterface::setBool(const string& key, const bool value) {
   assert(theSettings.get());
   assert(theOSystem.get());
   theSettings->setBool(key, value);
-  theSettings->validate();
 }
 void ALEInterface::setFloat(const string& key, const float value) {
   assert(theSettings.get());
   assert(theOSystem.get());
   theSettings->setFloat(key, value);
-  theSettings->validate();
 }
 
 
@@ -258,6 +363,7 @@ void ALEInterface::getScreenGrayscale(std::vector<unsigned char>& grayscale_outp
   size_t screen_size = w*h;
   
   pixel_t *ale_screen_data = environment->getScreen().getArray();
+  ALE_PROFILE_SCOPE(theOSystem->profiler(), PALETTE);
   theOSystem->colourPalette().applyPaletteGrayscale(grayscale_output_buffer, ale_screen_data, screen_size);
 }
 
@@ -271,14 +377,33 @@ void ALEInterface::getScreenRGB(std::vector<unsigned char>& output_rgb_buffer){
 
   pixel_t *ale_screen_data = environment->getScreen().getArray();
 
+  ALE_PROFILE_SCOPE(theOSystem->profiler(), PALETTE);
   theOSystem->colourPalette().applyPaletteRGB(output_rgb_buffer, ale_screen_data, screen_size * 3);
 }
 
+void ALEInterface::getObservation(unsigned char* output_buffer) {
+  const ObservationPipeline* pipeline = environment->getObservationPipeline();
+  if (pipeline == NULL) {
+    throw std::runtime_error("getObservation() requires preprocess_observations");
+  }
+  pipeline->getObservation(output_buffer);
+}
+
+size_t ALEInterface::getObservationSize() {
+  const ObservationPipeline* pipeline = environment->getObservationPipeline();
+  return pipeline != NULL ? pipeline->observationSize() : 0;
+}
+
 // Returns the current RAM content
 const ALERAM& ALEInterface::getRAM() {
   return environment->getRAM();
 }
 
+// Returns a view of the console RAM
+const unsigned char* ALEInterface::getRAMView() {
+  return theOSystem->console().system().ram();
+}
+
 // Saves the state of the system
 void ALEInterface::saveState() {
   environment->save();
@@ -290,21 +415,73 @@ void ALEInterface::loadState() {
 }
 
 ALEState ALEInterface::cloneState() {
+  ALE_PROFILE_COUNT(theOSystem->profiler(), CLONES, 1);
   return environment->cloneState();
 }
 
+ALEState ALEInterface::cloneState(const ALEState& parent) {
+  ALE_PROFILE_COUNT(theOSystem->profiler(), CLONES, 1);
+  return environment->cloneState(parent);
+}
+
 void ALEInterface::restoreState(const ALEState& state) {
+  ALE_PROFILE_COUNT(theOSystem->profiler(), RESTORES, 1);
   return environment->restoreState(state);
 }
 
 ALEState ALEInterface::cloneSystemState() {
+  ALE_PROFILE_COUNT(theOSystem->profiler(), CLONES, 1);
   return environment->cloneSystemState();
 }
 
 void ALEInterface::restoreSystemState(const ALEState& state) {
+  ALE_PROFILE_COUNT(theOSystem->profiler(), RESTORES, 1);
   return environment->restoreSystemState(state);
 }
 
+std::string ALEInterface::getProfileJSON() {
+  return theOSystem->profiler().toJSON();
+}
+
+void ALEInterface::resetProfile() {
+  theOSystem->profiler().reset();
+}
+
+std::map<std::string, size_t> ALEInterface::getMemoryUsage() const {
+  std::map<std::string, size_t> usage;
+  usage["settings"] = theSettings->memoryUsage();
+  usage["system"] = theOSystem->memoryUsage();
+  if (environment.get() != NULL) {
+    Console& console = theOSystem->console();
+    usage["console"] = console.memoryUsage();
+    usage["cpu"] = console.system().m6502().memoryUsage();
+    usage["tia"] = console.system().tia().memoryUsage();
+    usage["riot"] = console.riot().memoryUsage();
+    usage["cartridge"] = console.cartridge().memoryUsage();
+    usage["environment"] = sizeof(*this) + environment->memoryUsage();
+    usage["saved_states"] = environment->savedStateUsage();
+  }
+
+  // The ROM image is this interface's own unless another interface uses it too. This one
+  // holds it through its cartridge, and through m_rom_image if loaded from memory.
+  size_t shared = 0;
+  if (environment.get() != NULL) {
+    const std::shared_ptr<const RomImage>& rom = theOSystem->console().cartridge().romImage();
+    long own = (m_rom_image == rom) ? 2 : 1;
+    if (rom.use_count() > own)
+      shared = rom->memoryUsage();
+    else
+      usage["cartridge"] += rom->memoryUsage();
+  }
+
+  size_t total = 0;
+  for (std::map<std::string, size_t>::const_iterator it = usage.begin(); it != usage.end(); ++it)
+    total += it->second;
+  usage["total"] = total;
+  usage["shared"] = shared;
+  return usage;
+}
+
 void ALEInterface::saveScreenPNG(const string& filename) {
   
   ScreenExporter exporter(theOSystem->colourPalette());
@@ -32,6 +32,7 @@
 
 #include "emucore/FSNode.hxx"
 #include "emucore/OSystem.hxx"
+#include "emucore/RomImage.hxx"
 #include "os_dependent/SettingsWin32.hxx"
 #include "os_dependent/OSystemWin32.hxx"
 #include "os_dependent/SettingsUNIX.hxx"
@@ -43,10 +44,35 @@
 #include "common/Log.hpp"
 
 #include <string>
+#include <map>
 #include <memory>
+#include <vector>
+#include <utility>
 
 static const std::string Version = "0.5.1";
 
+/**
+   Settings for an interface that reads no configuration file. They are
+   applied in the order they were given, and unknown keys are rejected
+   when the interface is constructed.
+ */
+class ALEConfig {
+public:
+  void setString(const std::string& key, const std::string& value);
+  void setInt(const std::string& key, const int value);
+  void setBool(const std::string& key, const bool value);
+  void setFloat(const std::string& key, const float value);
+
+  // Sets every value on the given settings
+  void apply(Settings& settings) const;
+
+private:
+  std::vector<std::pair<std::string, std::string> > m_strings;
+  std::vector<std::pair<std::string, int> > m_ints;
+  std::vector<std::pair<std::string, bool> > m_bools;
+  std::vector<std::pair<std::string, float> > m_floats;
+};
+
 /**
    This class interfaces ALE with external code for controlling agents.
  */
@@ -56,6 +82,11 @@ public:
   ~ALEInterface();
   // Legacy constructor
   ALEInterface(bool display_screen);
+  // Hermetic constructor: applies the given settings and loads the game from the 'size' bytes
+  // of ROM at 'rom', without reading any file, configuration or properties included. The game
+  // is recognized by 'rom_name', the name its ROM file would have (e.g. "pong.bin").
+  ALEInterface(const ALEConfig& config, const uint8_t* rom, size_t size,
+               const std::string& rom_name);
 
   // Get the value of a setting.
   std::string getString(const std::string& key);
@@ -64,7 +95,7 @@ public:
   float getFloat(const std::string& key);
 
   // Set the value of a setting. loadRom() must be called before the
-  // setting will take effect.
+  // setting will take effect; settings are only validated then.
   void setString(const std::string& key, const std::string& value);
   void setInt(const std::string& key, const int value);
   void setBool(const std::string& key, const bool value);
@@ -75,6 +106,11 @@ public:
   // setting for the setting to take effect.
   void loadROM(std::string rom_file);
 
+  // Same as above, but the game is loaded from the 'size' bytes of ROM at 'rom' and recognized
+  // by 'rom_name'. No file is read; the ROM's properties are the built-in ones. Afterwards,
+  // loadROM("") reloads this ROM.
+  void loadROM(const uint8_t* rom, size_t size, const std::string& rom_name);
+
   // Applies an action to the game and returns the reward. It is the
   // user's responsibility to check if the game has ended and reset
   // when necessary - this method will keep pressing buttons on the
@@ -116,9 +152,21 @@ public:
   //followed by the green colours and then the blue colours
   void getScreenRGB(std::vector<unsigned char>& output_rgb_buffer);
 
+  // Writes the preprocessed observation, a stack of downsampled grayscale frames with the
+  // oldest frame first, into the given buffer of getObservationSize() bytes. Requires
+  // preprocess_observations to be set before loading the ROM.
+  void getObservation(unsigned char* output_buffer);
+
+  // The number of bytes in an observation, or 0 if preprocess_observations is off
+  size_t getObservationSize();
+
   // Returns the current RAM content
   const ALERAM &getRAM();
 
+  // Returns the console's RAM_SIZE bytes of RAM themselves, without copying. The view is
+  // always current and stays valid until the next loadROM().
+  const unsigned char* getRAMView();
+
   // Saves the state of the system
   void saveState();
 
@@ -129,6 +177,11 @@ public:
   // making it suitable for planning purposes. By contrast, see cloneSystemState.
   ALEState cloneState();
 
+  // Same as cloneState(), but only stores what differs from parent, a state previously returned
+  // by cloneState(). Siblings in a search tree then share one copy of their common ancestor
+  // state; the result is restored and serialized like any other state.
+  ALEState cloneState(const ALEState& parent);
+
   // Reverse operation of cloneState(). This does not restore pseudorandomness, so that repeated
   // calls to restoreState() in the stochastic controls setting will not lead to the same outcomes.
   // By contrast, see restoreSystemState.
@@ -141,6 +194,30 @@ public:
   // Reverse operation of cloneSystemState.
   void restoreSystemState(const ALEState& state);
 
+  // Returns a new interface in the same state as this one: the settings, the loaded game and
+  // the emulator state, including pseudorandomness, saved states and the screen. No file is
+  // read and the ROM's properties aren't looked up again. The caller owns the copy.
+  ALEInterface* clone() const;
+
+  // Returns the time and calls spent in each phase of emulation, plus instruction, frame,
+  // clone and restore counts, as a JSON object. They are only collected in builds
+  // configured with USE_PROFILING; "enabled" is false otherwise.
+  std::string getProfileJSON();
+
+  // Zeroes the counters
+  void resetProfile();
+
+  // Returns the bytes used by this interface, per subsystem: "settings", "system" (the
+  // OSystem and palette), "console" (with the system bus, switches and controllers),
+  // "cpu", "tia", "riot", "cartridge", "environment" (with the screen and observation
+  // pipeline), "saved_states" (with the reset cache) and their "total". "shared" is the
+  // memory shared with other interfaces of the same ROM: the ROM image, which is not part
+  // of the total while another interface uses it, and part of the cartridge otherwise.
+  // Allocator overhead is not counted. With the defaults an environment takes about
+  // 150 KB, 96 KB of which are the emulator's two frame buffers; compact_memory saves the
+  // 33 KB of the screen copy.
+  std::map<std::string, size_t> getMemoryUsage() const;
+
   // Save the current screen as a png file
   void saveScreenPNG(const std::string& filename);
 
@@ -162,8 +239,24 @@ public:
   static void disableBufferedIO();
   static void createOSystem(std::auto_ptr<OSystem> &theOSystem,
                             std::auto_ptr<Settings> &theSettings);
+  // Same as above, without loading the configuration file
+  static void newOSystem(std::auto_ptr<OSystem> &theOSystem,
+                         std::auto_ptr<Settings> &theSettings);
   static void loadSettings(const std::string& romfile,
                            std::auto_ptr<OSystem> &theOSystem);
+
+ private:
+  // Makes the copy returned by clone()
+  ALEInterface(const ALEInterface& other);
+
+  // Loads the game from the given ROM image
+  void loadROM(const std::shared_ptr<const RomImage>& image, const std::string& rom_name);
+
+  // Creates the environment of the game just loaded
+  void createEnvironment(const std::string& rom_name);
+
+  // The ROM image the game was loaded from, if it came from memory
+  std::shared_ptr<const RomImage> m_rom_image;
 };
 
 #endif
@@ -0,0 +1,255 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  ale_vector_interface.cpp
+ *
+ *  Steps a batch of environments on a pool of worker threads.
+ **************************************************************************** */
+
+#include "ale_vector_interface.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <climits>
+#include <random>
+
+ALEVectorInterface::ALEVectorInterface(int num_envs, int num_threads):
+  m_screen_width(0),
+  m_screen_height(0),
+  m_next_slab(0),
+  m_num_in_flight(0) {
+  if (num_envs < 1) {
+    throw std::invalid_argument("ALEVectorInterface needs at least one environment");
+  }
+
+  for (int i = 0; i < num_envs; i++) {
+    m_envs.push_back(new ALEInterface());
+  }
+  m_in_flight.assign(num_envs, 0);
+  m_async_rewards.assign(num_envs, 0);
+  m_async_terminals.assign(num_envs, 0);
+  m_async_errors.resize(num_envs);
+
+  if (num_threads <= 0) {
+    num_threads = std::thread::hardware_concurrency();
+  }
+  if (num_threads > num_envs) {
+    num_threads = num_envs;
+  }
+  // A single worker would only add a hand-off; step on the caller's thread instead
+  m_pool.reset(new ThreadPool(num_threads > 1 ? num_threads : 0));
+}
+
+ALEVectorInterface::~ALEVectorInterface() {
+  // Join the workers before the environments go away
+  m_pool.reset();
+  for (size_t i = 0; i < m_envs.size(); i++) {
+    delete m_envs[i];
+  }
+}
+
+std::string ALEVectorInterface::getString(const std::string& key) {
+  return m_envs[0]->getString(key);
+}
+int ALEVectorInterface::getInt(const std::string& key) {
+  return m_envs[0]->getInt(key);
+}
+bool ALEVectorInterface::getBool(const std::string& key) {
+  return m_envs[0]->getBool(key);
+}
+float ALEVectorInterface::getFloat(const std::string& key) {
+  return m_envs[0]->getFloat(key);
+}
+
+void ALEVectorInterface::setString(const std::string& key, const std::string& value) {
+  for (size_t i = 0; i < m_envs.size(); i++) m_envs[i]->setString(key, value);
+}
+void ALEVectorInterface::setInt(const std::string& key, const int value) {
+  for (size_t i = 0; i < m_envs.size(); i++) m_envs[i]->setInt(key, value);
+}
+void ALEVectorInterface::setBool(const std::string& key, const bool value) {
+  for (size_t i = 0; i < m_envs.size(); i++) m_envs[i]->setBool(key, value);
+}
+void ALEVectorInterface::setFloat(const std::string& key, const float value) {
+  for (size_t i = 0; i < m_envs.size(); i++) m_envs[i]->setFloat(key, value);
+}
+
+void ALEVectorInterface::loadROM(std::string rom_file) {
+  int seed = m_envs[0]->getInt("random_seed");
+  int num_envs = size();
+
+  // Seeding each environment from the clock would give them all the same seed
+  if (seed == 0) {
+    std::random_device device;
+    seed = std::uniform_int_distribution<int>(1, INT_MAX - num_envs)(device);
+  }
+  for (int i = 0; i < num_envs; i++) {
+    m_envs[i]->setInt("random_seed", seed + i);
+  }
+
+  m_pool->parallelFor(m_envs.size(), [&](size_t i) {
+    m_envs[i]->loadROM(rom_file);
+  });
+
+  // Asking an environment for its screen processes it, so the dimensions are kept here
+  // where they can be read while environments are stepping
+  m_screen_width = m_envs[0]->getScreen().width();
+  m_screen_height = m_envs[0]->getScreen().height();
+
+  for (int b = 0; b < 2; b++) {
+    m_slabs[b].env_ids.assign(num_envs, 0);
+    m_slabs[b].rewards.assign(num_envs, 0);
+    m_slabs[b].terminals.reset(new bool[num_envs]());
+    m_slabs[b].screens.assign(num_envs * m_screen_width * m_screen_height, 0);
+  }
+}
+
+void ALEVectorInterface::stepEnv(int i, Action action, reward_t& reward, bool& terminal) {
+  ALEInterface* env = m_envs[i];
+
+  reward = env->act(action);
+  terminal = env->game_over();
+  if (terminal) {
+    env->reset_game();
+  }
+}
+
+void ALEVectorInterface::copyScreen(int i, uint8_t* screens) {
+  const ALEScreen& screen = m_envs[i]->getScreen();
+  size_t screen_size = screen.arraySize();
+  memcpy(screens + i * screen_size, screen.getArray(), screen_size);
+}
+
+void ALEVectorInterface::act_batch(const int* actions, int* rewards, bool* terminals,
+                                   uint8_t* screens) {
+  if (m_num_in_flight > 0) {
+    throw std::logic_error("act_batch() called while asynchronous steps are in flight");
+  }
+
+  m_pool->parallelFor(m_envs.size(), [&](size_t i) {
+    reward_t reward;
+    bool terminal;
+    stepEnv(i, (Action)actions[i], reward, terminal);
+
+    if (rewards != NULL) rewards[i] = reward;
+    if (terminals != NULL) terminals[i] = terminal;
+    if (screens != NULL) copyScreen(i, screens);
+  });
+}
+
+void ALEVectorInterface::reset_all(uint8_t* screens) {
+  if (m_num_in_flight > 0) {
+    throw std::logic_error("reset_all() called while asynchronous steps are in flight");
+  }
+
+  m_pool->parallelFor(m_envs.size(), [&](size_t i) {
+    m_envs[i]->reset_game();
+    if (screens != NULL) copyScreen(i, screens);
+  });
+}
+
+void ALEVectorInterface::send(const int* actions, const int* env_ids, int count) {
+  for (int j = 0; j < count; j++) {
+    int i = env_ids != NULL ? env_ids[j] : j;
+    if (i < 0 || i >= size()) {
+      throw std::out_of_range("send(): environment id out of range");
+    }
+    if (m_in_flight[i]) {
+      throw std::logic_error("send(): environment already has a step in flight");
+    }
+    m_in_flight[i] = 1;
+    m_num_in_flight++;
+
+    Action action = (Action)actions[j];
+    m_pool->enqueue([this, i, action]() {
+      reward_t reward = 0;
+      bool terminal = false;
+      std::exception_ptr error;
+      try {
+        stepEnv(i, action, reward, terminal);
+      }
+      catch (...) {
+        // Handed to recv(), on the caller's thread
+        error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(m_async_mutex);
+      m_async_rewards[i] = reward;
+      m_async_terminals[i] = terminal;
+      m_async_errors[i] = error;
+      m_completed.push_back(i);
+      m_async_done.notify_one();
+    });
+  }
+}
+
+int ALEVectorInterface::recv(int batch_size) {
+  if (batch_size < 1 || batch_size > m_num_in_flight) {
+    throw std::logic_error("recv(): batch_size must be between 1 and the number of steps in flight");
+  }
+
+  Slab& slab = m_slabs[m_next_slab];
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(m_async_mutex);
+    while (m_completed.size() < static_cast<size_t>(batch_size))
+      m_async_done.wait(lock);
+
+    for (int j = 0; j < batch_size; j++) {
+      int i = m_completed.front();
+      m_completed.pop_front();
+      slab.env_ids[j] = i;
+      slab.rewards[j] = m_async_rewards[i];
+      slab.terminals[j] = m_async_terminals[i] != 0;
+      if (m_async_errors[i] && !error)
+        error = m_async_errors[i];
+      m_async_errors[i] = std::exception_ptr();
+    }
+  }
+
+  // The finished environments are idle until the caller sends to them again,
+  // so their screens can be gathered without holding the lock.
+  size_t screen_size = (size_t)m_screen_width * m_screen_height;
+  for (int j = 0; j < batch_size; j++) {
+    int i = slab.env_ids[j];
+    memcpy(&slab.screens[j * screen_size], m_envs[i]->getScreen().getArray(), screen_size);
+    m_in_flight[i] = 0;
+  }
+  m_num_in_flight -= batch_size;
+
+  // The environments are no longer in flight, so the caller may carry on after handling it
+  if (error)
+    std::rethrow_exception(error);
+
+  int returned = m_next_slab;
+  m_next_slab ^= 1;
+  return returned;
+}
+
+void ALEVectorInterface::getScreens(uint8_t* screens) {
+  for (size_t i = 0; i < m_envs.size(); i++) {
+    copyScreen(i, screens);
+  }
+}
+
+int ALEVectorInterface::getScreenWidth() const {
+  return m_screen_width;
+}
+
+int ALEVectorInterface::getScreenHeight() const {
+  return m_screen_height;
+}
+
+ActionVect ALEVectorInterface::getLegalActionSet() {
+  return m_envs[0]->getLegalActionSet();
+}
+
+ActionVect ALEVectorInterface::getMinimalActionSet() {
+  return m_envs[0]->getMinimalActionSet();
+}
@@ -0,0 +1,144 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  ale_vector_interface.hpp
+ *
+ *  Steps a batch of environments on a pool of worker threads.
+ **************************************************************************** */
+#ifndef __ALE_VECTOR_INTERFACE_HPP__
+#define __ALE_VECTOR_INTERFACE_HPP__
+
+#include "ale_interface.hpp"
+#include "common/ThreadPool.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <exception>
+#include <stdint.h>
+
+/**
+   Owns a fixed number of environments running the same ROM and steps them
+   in lockstep across a pool of worker threads. Observations of all
+   environments are written into one contiguous [N, height, width] buffer of
+   raw palette indices (see ALEInterface::getScreen).
+ */
+class ALEVectorInterface {
+public:
+  // Creates num_envs environments. num_threads <= 0 uses one thread per
+  // hardware core (but never more threads than environments).
+  ALEVectorInterface(int num_envs, int num_threads = 0);
+  ~ALEVectorInterface();
+
+  // Get the value of a setting (identical for all environments).
+  std::string getString(const std::string& key);
+  int getInt(const std::string& key);
+  bool getBool(const std::string& key);
+  float getFloat(const std::string& key);
+
+  // Set the value of a setting in every environment. loadROM() must be
+  // called before the setting will take effect.
+  void setString(const std::string& key, const std::string& value);
+  void setInt(const std::string& key, const int value);
+  void setBool(const std::string& key, const bool value);
+  void setFloat(const std::string& key, const float value);
+
+  // Loads the game in every environment. A non-zero random_seed s gives
+  // environment i the seed s + i, so that the environments do not replay
+  // each other's stochasticity. With random_seed 0, s is drawn at random.
+  void loadROM(std::string rom_file);
+
+  // Applies actions[i] to environment i, writing its reward and terminal flag
+  // to rewards[i] and terminals[i], and its screen to screens[i]. An
+  // environment that reaches a terminal state is reset within the same call,
+  // so screens[i] then holds the first frame of the new episode. Any output
+  // pointer may be NULL.
+  void act_batch(const int* actions, int* rewards, bool* terminals,
+                 uint8_t* screens);
+
+  // Resets every environment and optionally writes the starting screens.
+  void reset_all(uint8_t* screens);
+
+  // Writes the current screen of every environment into screens.
+  void getScreens(uint8_t* screens);
+
+  // Asynchronous stepping. send() queues actions[j] for environment
+  // env_ids[j] (env_ids may be NULL to address environments 0..count-1) and
+  // returns immediately; an environment may only have one step in flight.
+  // recv() blocks until batch_size environments have finished, in completion
+  // order, and gathers their results into one of two preallocated slabs,
+  // whose index it returns. Slabs alternate, so the results of one recv()
+  // stay valid until the next-but-one recv(). send()/recv() must be called
+  // from a single thread, and act_batch() may not be mixed with steps in
+  // flight. Terminal environments are reset as in act_batch(). If a step
+  // throws, recv() rethrows the exception once it has gathered the batch.
+  void send(const int* actions, const int* env_ids, int count);
+  int recv(int batch_size);
+
+  // Views into slab 0 or 1; after recv() returns a slab, its first
+  // batch_size entries hold the environment ids, rewards, terminal flags and
+  // [batch_size, height, width] screens.
+  int* slabEnvIds(int slab) { return &m_slabs[slab].env_ids[0]; }
+  int* slabRewards(int slab) { return &m_slabs[slab].rewards[0]; }
+  bool* slabTerminals(int slab) { return m_slabs[slab].terminals.get(); }
+  uint8_t* slabScreens(int slab) { return &m_slabs[slab].screens[0]; }
+
+  // Number of environments.
+  int size() const { return static_cast<int>(m_envs.size()); }
+
+  // Number of worker threads.
+  int numThreads() const { return static_cast<int>(m_pool->size()); }
+
+  // Screen dimensions; 0 until a ROM is loaded.
+  int getScreenWidth() const;
+  int getScreenHeight() const;
+
+  // Action sets of the loaded game (identical for all environments).
+  ActionVect getLegalActionSet();
+  ActionVect getMinimalActionSet();
+
+  // Direct access to a single environment.
+  ALEInterface& getEnv(int i) { return *m_envs[i]; }
+
+ private:
+  void stepEnv(int i, Action action, reward_t& reward, bool& terminal);
+  void copyScreen(int i, uint8_t* screens);
+
+  std::vector<ALEInterface*> m_envs;
+  std::unique_ptr<ThreadPool> m_pool;
+  int m_screen_width, m_screen_height;
+
+  // Output buffers handed out by recv()
+  struct Slab {
+    std::vector<int> env_ids;
+    std::vector<int> rewards;
+    std::unique_ptr<bool[]> terminals;
+    std::vector<uint8_t> screens;
+  };
+  Slab m_slabs[2];
+  int m_next_slab;
+
+  // Asynchronous stepping state. Results are written by the workers and
+  // published, under m_async_mutex, by pushing the env id onto m_completed.
+  std::vector<char> m_in_flight;
+  std::vector<reward_t> m_async_rewards;
+  std::vector<char> m_async_terminals;
+  std::vector<std::exception_ptr> m_async_errors;
+  int m_num_in_flight;
+  std::deque<int> m_completed;
+  std::mutex m_async_mutex;
+  std::condition_variable m_async_done;
+
+  // Disallow copying
+  ALEVectorInterface(const ALEVectorInterface&);
+  ALEVectorInterface& operator=(const ALEVectorInterface&);
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include <math.h>
 #include <fstream>
 #include "Palettes.hpp"
+#include "PaletteKernels.hpp"
 
 using namespace std;
 
@@ -71,53 +72,53 @@ uInt32 ColourPalette::getRGB(int val) const
     return m_palette[val];
 }
 
-void ColourPalette::applyPaletteRGB(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size)
+void ColourPalette::applyPaletteRGB(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const
 {
-    uInt8 *p = src_buffer;
-    uInt8 *q = dst_buffer;
-
-    for(size_t i = 0; i < src_size; i++, p++){
-        int rgb = m_palette[*p];
-        *q = (unsigned char) ((rgb >> 16));  q++;    // r
-        *q = (unsigned char) ((rgb >>  8));  q++;    // g
-        *q = (unsigned char) ((rgb >>  0));  q++;    // b
-    }
+    PaletteKernels::best().lookupRGB(m_red, m_green, m_blue, src_buffer, dst_buffer, src_size);
 }
 
-void ColourPalette::applyPaletteRGB(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size)
+void ColourPalette::applyPaletteRGB(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size) const
 {
     dst_buffer.resize(3 * src_size);
     assert(dst_buffer.size() == 3 * src_size);
 
-    uInt8 *p = src_buffer;
-
-    for(size_t i = 0; i < src_size * 3; i += 3, p++){
-        int rgb = m_palette[*p];
-        dst_buffer[i+0] = (unsigned char) ((rgb >> 16));    // r
-        dst_buffer[i+1] = (unsigned char) ((rgb >>  8));    // g
-        dst_buffer[i+2] = (unsigned char) ((rgb >>  0));    // b
-    }
+    applyPaletteRGB(&dst_buffer[0], src_buffer, src_size);
 }
 
-void ColourPalette::applyPaletteGrayscale(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size)
+void ColourPalette::applyPaletteGrayscale(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const
 {
-    uInt8 *p = src_buffer;
-    uInt8 *q = dst_buffer;
-
-    for(size_t i = 0; i < src_size; i++, p++, q++){
-        *q = (unsigned char) (m_palette[*p+1] & 0xFF);
-    }
+    PaletteKernels::best().lookup(m_gray, src_buffer, dst_buffer, src_size);
 }
 
-void ColourPalette::applyPaletteGrayscale(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size)
+void ColourPalette::applyPaletteGrayscale(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size) const
 {
     dst_buffer.resize(src_size);
     assert(dst_buffer.size() == src_size);
 
-    uInt8 *p = src_buffer;
+    applyPaletteGrayscale(&dst_buffer[0], src_buffer, src_size);
+}
+
+void ColourPalette::applyPaletteRGBA(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const
+{
+    PaletteKernels::best().lookupRGBA(m_red, m_green, m_blue, src_buffer, dst_buffer, src_size);
+}
+
+void ColourPalette::applyPalettePlanar(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const
+{
+    const PaletteKernels& kernels = PaletteKernels::best();
+    kernels.lookup(m_red, src_buffer, dst_buffer, src_size);
+    kernels.lookup(m_green, src_buffer, dst_buffer + src_size, src_size);
+    kernels.lookup(m_blue, src_buffer, dst_buffer + 2 * src_size, src_size);
+}
 
-    for(size_t i = 0; i < src_size; i++, p++){
-        dst_buffer[i] = (unsigned char) (m_palette[*p+1] & 0xFF);
+void ColourPalette::makeLookupTables()
+{
+    for (int i = 0; i < 256; i++) {
+        m_red[i]   = (m_palette[i] >> 16) & 0xFF;
+        m_green[i] = (m_palette[i] >>  8) & 0xFF;
+        m_blue[i]  = (m_palette[i] >>  0) & 0xFF;
+        // Odd entries hold the grayscale version of the colour below them
+        m_gray[i]  = m_palette[i | 1] & 0xFF;
     }
 }
 
@@ -130,7 +131,7 @@ void ColourPalette::setPalette(const string& type,
         paletteNum = 0;
     else if(type == "z26")
         paletteNum = 1;
-    else if(type == "user" && myUserPaletteDefined)
+    else if(type == "user" && !m_userPalettes.empty())
         paletteNum = 2;
 
     int paletteFormat = 0;
@@ -139,13 +140,16 @@ void ColourPalette::setPalette(const string& type,
     else if (displayFormat.compare(0, 5, "SECAM") == 0)
         paletteFormat = 2;
 
-    uInt32* paletteMapping[3][3] = {
+    uInt32* paletteMapping[2][3] = {
         {NTSCPalette,       PALPalette,     SECAMPalette},
-        {NTSCPaletteZ26,    PALPaletteZ26,  SECAMPaletteZ26},
-        {m_userNTSCPalette, m_userPALPalette, m_userSECAMPalette}
+        {NTSCPaletteZ26,    PALPaletteZ26,  SECAMPaletteZ26}
     };
 
-    m_palette  = paletteMapping[paletteNum][paletteFormat];
+    if (paletteNum == 2)
+        m_palette = &m_userPalettes[paletteFormat * 256];
+    else
+        m_palette = paletteMapping[paletteNum][paletteFormat];
+    makeLookupTables();
 }
 
 void ColourPalette::loadUserPalette(const string& paletteFile)
@@ -177,20 +181,25 @@ void ColourPalette::loadUserPalette(const string& paletteFile)
         return;
     }
 
-    // Now that we have valid data, create the user-defined palettes
+    // Now that we have valid data, create the user-defined palettes. They stay
+    // where they are if they were loaded before, as m_palette may point to them.
+    m_userPalettes.resize(3 * 256);
+    uInt32* ntscPalette = &m_userPalettes[0];
+    uInt32* palPalette = &m_userPalettes[256];
+    uInt32* secamPalette = &m_userPalettes[512];
     uInt8 pixbuf[bytesPerColor];  // Temporary buffer for one 24-bit pixel
 
     for(int i = 0; i < NTSCPaletteSize; i++)  // NTSC palette
     {
         paletteStream.read((char*)pixbuf, bytesPerColor);
-        m_userNTSCPalette[(i<<1)] = packRGB(pixbuf[0], pixbuf[1], pixbuf[2]);
-        m_userNTSCPalette[(i<<1)+1] = convertGrayscale(m_userNTSCPalette[(i<<1)]);
+        ntscPalette[(i<<1)] = packRGB(pixbuf[0], pixbuf[1], pixbuf[2]);
+        ntscPalette[(i<<1)+1] = convertGrayscale(ntscPalette[(i<<1)]);
     }
     for(int i = 0; i < PALPaletteSize; i++)  // PAL palette
     {
         paletteStream.read((char*)pixbuf, bytesPerColor);
-        m_userPALPalette[(i<<1)] = packRGB(pixbuf[0], pixbuf[1], pixbuf[2]);
-        m_userPALPalette[(i<<1)+1] = convertGrayscale(m_userPALPalette[(i<<1)]);
+        palPalette[(i<<1)] = packRGB(pixbuf[0], pixbuf[1], pixbuf[2]);
+        palPalette[(i<<1)+1] = convertGrayscale(palPalette[(i<<1)]);
     }
 
     uInt32 tmpSecam[SECAMPaletteSize*2];         // All 8 24-bit pixels, plus 8 colorloss pixels
@@ -201,7 +210,7 @@ void ColourPalette::loadUserPalette(const string& paletteFile)
         tmpSecam[(i<<1)+1] = convertGrayscale(tmpSecam[(i<<1)]);
     }
 
-    uInt32*tmpSECAMPalettePtr = m_userSECAMPalette;
+    uInt32*tmpSECAMPalettePtr = secamPalette;
     for(int i = 0; i < 16; ++i)
     {
         memcpy(tmpSECAMPalettePtr, tmpSecam, SECAMPaletteSize*2);
@@ -210,5 +219,12 @@ void ColourPalette::loadUserPalette(const string& paletteFile)
 
     paletteStream.close();
 
-    myUserPaletteDefined = true;
+    // The user-defined palette may be the current one
+    if (m_palette != NULL)
+        makeLookupTables();
+}
+
+size_t ColourPalette::memoryUsage() const
+{
+    return m_userPalettes.capacity() * sizeof(uInt32);
 }
@@ -41,16 +41,30 @@ class ColourPalette {
             For each byte in src_buffer, three bytes are returned in dst_buffer
             8 bits => 24 bits
          */
-        void applyPaletteRGB(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size);
-        void applyPaletteRGB(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size);
+        void applyPaletteRGB(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const;
+        void applyPaletteRGB(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size) const;
 
         /**
             Applies the current grayscale palette to the src_buffer and returns the results in dst_buffer
             For each byte in src_buffer, a single byte is returned in dst_buffer
             8 bits => 8 bits
          */
-        void applyPaletteGrayscale(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size);
-        void applyPaletteGrayscale(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size);
+        void applyPaletteGrayscale(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const;
+        void applyPaletteGrayscale(std::vector<unsigned char>& dst_buffer, uInt8 *src_buffer, size_t src_size) const;
+
+        /**
+            Applies the current RGB palette to the src_buffer and returns the results in dst_buffer
+            For each byte in src_buffer, four bytes (R, G, B and an opaque alpha) are returned
+            8 bits => 32 bits
+         */
+        void applyPaletteRGBA(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const;
+
+        /**
+            Applies the current RGB palette to the src_buffer and returns the results in dst_buffer
+            as three planes of src_size bytes: first all red values, then green, then blue
+            8 bits => 3 x 8 bits
+         */
+        void applyPalettePlanar(uInt8* dst_buffer, uInt8 *src_buffer, size_t src_size) const;
 
         /**
           Loads all defined palettes with PAL color-loss data depending
@@ -69,15 +83,21 @@ class ColourPalette {
         */
         void loadUserPalette(const std::string& paletteFile);
 
+        /** Returns the memory the palette allocated, which is for a user palette if one was loaded. */
+        size_t memoryUsage() const;
+
 private:
+        /** Rebuilds the per-channel lookup tables from m_palette */
+        void makeLookupTables();
+
         uInt32 *m_palette;
 
-        bool myUserPaletteDefined;
+        // Per-channel tables derived from m_palette for the conversion kernels
+        uInt8 m_red[256], m_green[256], m_blue[256], m_gray[256];
 
-        // Table of RGB values for NTSC, PAL and SECAM - user-defined
-        uInt32 m_userNTSCPalette[256];
-        uInt32 m_userPALPalette[256];
-        uInt32 m_userSECAMPalette[256];
+        // Table of RGB values for NTSC, PAL and SECAM - user-defined, one after the
+        // other. Empty unless a user palette was loaded.
+        std::vector<uInt32> m_userPalettes;
 };
 
 #endif // __COLOUR_PALETTE_HPP__ 
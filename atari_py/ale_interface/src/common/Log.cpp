@@ -1,15 +1,31 @@
 #include "Log.hpp"
 #include <iostream>
+#include <mutex>
 using namespace ale;
 
-Logger::mode Logger::current_mode = Info;
+std::atomic<int> Logger::current_mode(Info);
+
+// Serializes the writes of complete messages to std::cerr
+static std::mutex output_mutex;
 
 void Logger::setMode(Logger::mode m){
     current_mode = m;
 }
 
+std::ostringstream& Logger::buffer(){
+    static thread_local std::ostringstream message;
+    return message;
+}
+
 ale::Logger::mode ale::operator<<(ale::Logger::mode log, std::ostream & (*manip)(std::ostream &)) {
-    if(log >= Logger::current_mode)
-        manip(std::cerr);
+    if(log >= Logger::current_mode) {
+        std::ostringstream& message = Logger::buffer();
+        manip(message);
+
+        std::lock_guard<std::mutex> lock(output_mutex);
+        std::cerr << message.str();
+        std::cerr.flush();
+        message.str("");
+    }
     return log;
 }
@@ -1,6 +1,8 @@
 #ifndef __LOG_HPP__
 #define __LOG_HPP__
 #include <iostream>
+#include <sstream>
+#include <atomic>
 namespace ale
 {
     class Logger
@@ -17,7 +19,12 @@ namespace ale
          */
         static void setMode(mode m);
     private:
-        static mode current_mode;
+        static std::atomic<int> current_mode;
+        /** @brief Per-thread buffer holding the message being built. It is written
+         * to std::cerr in one piece when a manipulator such as std::endl is streamed,
+         * so that messages from concurrent emulators do not interleave.
+         */
+        static std::ostringstream& buffer();
         friend mode operator<<(mode,std::ostream&(*manip)(std::ostream &));
         template<typename T>
         friend mode operator<<(mode, const T&);
@@ -29,7 +36,7 @@ namespace ale
     template<typename T>
     Logger::mode operator << (Logger::mode log, const T& val){
         if(log>=Logger::current_mode)
-            std::cerr << val;
+            Logger::buffer() << val;
         return log;
     }
 
@@ -0,0 +1,328 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  PaletteKernels.cpp
+ *
+ *  Vectorized conversion of palette indices through per-channel lookup tables,
+ *  with the implementation picked for the CPU at runtime.
+ **************************************************************************** */
+
+#include "PaletteKernels.hpp"
+
+// The x86 kernels are compiled for their instruction set with target attributes, so the
+// rest of the library does not need to be built for it
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ALE_X86_PALETTE_KERNELS
+#include <immintrin.h>
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+static void lookupPortable(const uInt8* table, const uInt8* src, uInt8* dst, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        dst[i] = table[src[i]];
+}
+
+static void lookupRGBPortable(const uInt8* red, const uInt8* green, const uInt8* blue,
+                              const uInt8* src, uInt8* dst, size_t size) {
+    for (size_t i = 0; i < size; i++, dst += 3) {
+        dst[0] = red[src[i]];
+        dst[1] = green[src[i]];
+        dst[2] = blue[src[i]];
+    }
+}
+
+static void lookupRGBAPortable(const uInt8* red, const uInt8* green, const uInt8* blue,
+                               const uInt8* src, uInt8* dst, size_t size) {
+    for (size_t i = 0; i < size; i++, dst += 4) {
+        dst[0] = red[src[i]];
+        dst[1] = green[src[i]];
+        dst[2] = blue[src[i]];
+        dst[3] = 0xFF;
+    }
+}
+
+static void lookupPairPortable(const uInt8* table, const uInt8* first, const uInt8* second,
+                               uInt8* dst, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        dst[i] = table[(first[i] << 8) | second[i]];
+}
+
+#ifdef ALE_X86_PALETTE_KERNELS
+
+/**
+    The vector lookups only use the 128 entries at even indices, which fit in eight
+    16-byte shuffle tables: the table for block k serves half-indices [16k, 16k + 16).
+ */
+TARGET_SSSE3 static void loadEvenEntries(const uInt8* table, __m128i* blocks) {
+    const __m128i low_bytes = _mm_set1_epi16(0x00FF);
+    for (int k = 0; k < 8; k++) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 32 * k));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 32 * k + 16));
+        blocks[k] = _mm_packus_epi16(_mm_and_si128(a, low_bytes), _mm_and_si128(b, low_bytes));
+    }
+}
+
+/** Masks that interleave three 16-byte channel vectors into 48 bytes of RGB */
+TARGET_SSSE3 static void makeInterleaveMasks(__m128i masks[3][3]) {
+    for (int chunk = 0; chunk < 3; chunk++) {
+        for (int channel = 0; channel < 3; channel++) {
+            uInt8 mask[16];
+            for (int j = 0; j < 16; j++) {
+                int p = 16 * chunk + j;
+                mask[j] = (p % 3 == channel) ? (uInt8)(p / 3) : 0x80;
+            }
+            masks[chunk][channel] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+        }
+    }
+}
+
+TARGET_SSSE3 static inline void storeRGB(const __m128i masks[3][3], __m128i r, __m128i g,
+                                         __m128i b, uInt8* dst) {
+    for (int chunk = 0; chunk < 3; chunk++) {
+        __m128i out = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, masks[chunk][0]),
+                                                _mm_shuffle_epi8(g, masks[chunk][1])),
+                                   _mm_shuffle_epi8(b, masks[chunk][2]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16 * chunk), out);
+    }
+}
+
+TARGET_SSSE3 static inline void storeRGBA(__m128i r, __m128i g, __m128i b, uInt8* dst) {
+    const __m128i alpha = _mm_set1_epi8((char)0xFF);
+    __m128i rg_lo = _mm_unpacklo_epi8(r, g), rg_hi = _mm_unpackhi_epi8(r, g);
+    __m128i ba_lo = _mm_unpacklo_epi8(b, alpha), ba_hi = _mm_unpackhi_epi8(b, alpha);
+    __m128i* out = reinterpret_cast<__m128i*>(dst);
+    _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(rg_hi, ba_hi));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(rg_hi, ba_hi));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// SSSE3: 16 pixels at a time
+
+/** True if any of the indices is odd */
+TARGET_SSSE3 static inline bool hasOddIndex(__m128i v) {
+    return _mm_movemask_epi8(_mm_slli_epi16(v, 7)) != 0;
+}
+
+TARGET_SSSE3 static inline __m128i lookup16(const __m128i* blocks, __m128i v) {
+    __m128i index = _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi8(0x7F));
+    // Subtracting 16k and then adding 0x70 with saturation keeps the low nibble of the
+    // indices within block k, and sets bit 7 of all others so that the shuffle zeroes them
+    __m128i result = _mm_setzero_si128();
+    for (int k = 0; k < 8; k++) {
+        __m128i i = _mm_adds_epu8(_mm_sub_epi8(index, _mm_set1_epi8(16 * k)), _mm_set1_epi8(0x70));
+        result = _mm_or_si128(result, _mm_shuffle_epi8(blocks[k], i));
+    }
+    return result;
+}
+
+TARGET_SSSE3 static void lookupSSSE3(const uInt8* table, const uInt8* src, uInt8* dst, size_t size) {
+    __m128i blocks[8];
+    loadEvenEntries(table, blocks);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (hasOddIndex(v))
+            lookupPortable(table, src + i, dst + i, 16);
+        else
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), lookup16(blocks, v));
+    }
+    lookupPortable(table, src + i, dst + i, size - i);
+}
+
+TARGET_SSSE3 static void lookupRGBSSSE3(const uInt8* red, const uInt8* green, const uInt8* blue,
+                                        const uInt8* src, uInt8* dst, size_t size) {
+    __m128i r_blocks[8], g_blocks[8], b_blocks[8], masks[3][3];
+    loadEvenEntries(red, r_blocks);
+    loadEvenEntries(green, g_blocks);
+    loadEvenEntries(blue, b_blocks);
+    makeInterleaveMasks(masks);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (hasOddIndex(v))
+            lookupRGBPortable(red, green, blue, src + i, dst + 3 * i, 16);
+        else
+            storeRGB(masks, lookup16(r_blocks, v), lookup16(g_blocks, v), lookup16(b_blocks, v),
+                     dst + 3 * i);
+    }
+    lookupRGBPortable(red, green, blue, src + i, dst + 3 * i, size - i);
+}
+
+TARGET_SSSE3 static void lookupRGBASSSE3(const uInt8* red, const uInt8* green, const uInt8* blue,
+                                         const uInt8* src, uInt8* dst, size_t size) {
+    __m128i r_blocks[8], g_blocks[8], b_blocks[8];
+    loadEvenEntries(red, r_blocks);
+    loadEvenEntries(green, g_blocks);
+    loadEvenEntries(blue, b_blocks);
+
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (hasOddIndex(v))
+            lookupRGBAPortable(red, green, blue, src + i, dst + 4 * i, 16);
+        else
+            storeRGBA(lookup16(r_blocks, v), lookup16(g_blocks, v), lookup16(b_blocks, v),
+                      dst + 4 * i);
+    }
+    lookupRGBAPortable(red, green, blue, src + i, dst + 4 * i, size - i);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// AVX2: 32 pixels at a time. The shuffles work within 128-bit lanes, so each
+// lane gets its own copy of the tables.
+
+TARGET_AVX2 static void loadEvenEntries256(const uInt8* table, __m256i* blocks) {
+    __m128i narrow[8];
+    loadEvenEntries(table, narrow);
+    for (int k = 0; k < 8; k++)
+        blocks[k] = _mm256_broadcastsi128_si256(narrow[k]);
+}
+
+TARGET_AVX2 static inline bool hasOddIndex256(__m256i v) {
+    return _mm256_movemask_epi8(_mm256_slli_epi16(v, 7)) != 0;
+}
+
+TARGET_AVX2 static inline __m256i lookup32(const __m256i* blocks, __m256i v) {
+    __m256i index = _mm256_and_si256(_mm256_srli_epi16(v, 1), _mm256_set1_epi8(0x7F));
+    __m256i result = _mm256_setzero_si256();
+    for (int k = 0; k < 8; k++) {
+        __m256i i = _mm256_adds_epu8(_mm256_sub_epi8(index, _mm256_set1_epi8(16 * k)),
+                                     _mm256_set1_epi8(0x70));
+        result = _mm256_or_si256(result, _mm256_shuffle_epi8(blocks[k], i));
+    }
+    return result;
+}
+
+TARGET_AVX2 static void lookupAVX2(const uInt8* table, const uInt8* src, uInt8* dst, size_t size) {
+    __m256i blocks[8];
+    loadEvenEntries256(table, blocks);
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (hasOddIndex256(v))
+            lookupPortable(table, src + i, dst + i, 32);
+        else
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), lookup32(blocks, v));
+    }
+    lookupPortable(table, src + i, dst + i, size - i);
+}
+
+TARGET_AVX2 static void lookupRGBAVX2(const uInt8* red, const uInt8* green, const uInt8* blue,
+                                      const uInt8* src, uInt8* dst, size_t size) {
+    __m256i r_blocks[8], g_blocks[8], b_blocks[8];
+    __m128i masks[3][3];
+    loadEvenEntries256(red, r_blocks);
+    loadEvenEntries256(green, g_blocks);
+    loadEvenEntries256(blue, b_blocks);
+    makeInterleaveMasks(masks);
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (hasOddIndex256(v)) {
+            lookupRGBPortable(red, green, blue, src + i, dst + 3 * i, 32);
+            continue;
+        }
+        __m256i r = lookup32(r_blocks, v), g = lookup32(g_blocks, v), b = lookup32(b_blocks, v);
+        storeRGB(masks, _mm256_castsi256_si128(r), _mm256_castsi256_si128(g),
+                 _mm256_castsi256_si128(b), dst + 3 * i);
+        storeRGB(masks, _mm256_extracti128_si256(r, 1), _mm256_extracti128_si256(g, 1),
+                 _mm256_extracti128_si256(b, 1), dst + 3 * i + 48);
+    }
+    lookupRGBPortable(red, green, blue, src + i, dst + 3 * i, size - i);
+}
+
+TARGET_AVX2 static void lookupRGBAAVX2(const uInt8* red, const uInt8* green, const uInt8* blue,
+                                       const uInt8* src, uInt8* dst, size_t size) {
+    __m256i r_blocks[8], g_blocks[8], b_blocks[8];
+    loadEvenEntries256(red, r_blocks);
+    loadEvenEntries256(green, g_blocks);
+    loadEvenEntries256(blue, b_blocks);
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        if (hasOddIndex256(v)) {
+            lookupRGBAPortable(red, green, blue, src + i, dst + 4 * i, 32);
+            continue;
+        }
+        __m256i r = lookup32(r_blocks, v), g = lookup32(g_blocks, v), b = lookup32(b_blocks, v);
+        storeRGBA(_mm256_castsi256_si128(r), _mm256_castsi256_si128(g),
+                  _mm256_castsi256_si128(b), dst + 4 * i);
+        storeRGBA(_mm256_extracti128_si256(r, 1), _mm256_extracti128_si256(g, 1),
+                  _mm256_extracti128_si256(b, 1), dst + 4 * i + 64);
+    }
+    lookupRGBAPortable(red, green, blue, src + i, dst + 4 * i, size - i);
+}
+
+/** A 64K-entry table does not fit in shuffles; gather 32-bit words at the byte offsets
+    instead and keep their low bytes */
+TARGET_AVX2 static void lookupPairAVX2(const uInt8* table, const uInt8* first, const uInt8* second,
+                                       uInt8* dst, size_t size) {
+    const __m256i low_byte = _mm256_set1_epi32(0xFF);
+    // packus interleaves the lanes of its inputs; this puts the words back in order
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i words[4];
+        for (int k = 0; k < 4; k++) {
+            __m256i a = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(first + i + 8 * k)));
+            __m256i b = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(second + i + 8 * k)));
+            __m256i index = _mm256_or_si256(_mm256_slli_epi32(a, 8), b);
+            words[k] = _mm256_and_si256(
+                _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 1), low_byte);
+        }
+        __m256i bytes = _mm256_packus_epi16(_mm256_packus_epi32(words[0], words[1]),
+                                            _mm256_packus_epi32(words[2], words[3]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                            _mm256_permutevar8x32_epi32(bytes, order));
+    }
+    lookupPairPortable(table, first + i, second + i, dst + i, size - i);
+}
+
+#endif // ALE_X86_PALETTE_KERNELS
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const PaletteKernels& PaletteKernels::portable() {
+    static const PaletteKernels kernels = {
+        lookupPortable, lookupRGBPortable, lookupRGBAPortable, lookupPairPortable, "portable"
+    };
+    return kernels;
+}
+
+static const PaletteKernels& selectKernels() {
+#ifdef ALE_X86_PALETTE_KERNELS
+    static const PaletteKernels avx2 = {
+        lookupAVX2, lookupRGBAVX2, lookupRGBAAVX2, lookupPairAVX2, "avx2"
+    };
+    static const PaletteKernels ssse3 = {
+        lookupSSSE3, lookupRGBSSSE3, lookupRGBASSSE3, lookupPairPortable, "ssse3"
+    };
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return ssse3;
+#endif
+    return PaletteKernels::portable();
+}
+
+const PaletteKernels& PaletteKernels::best() {
+    static const PaletteKernels& kernels = selectKernels();
+    return kernels;
+}
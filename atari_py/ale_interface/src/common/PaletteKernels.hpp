@@ -0,0 +1,58 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  PaletteKernels.hpp
+ *
+ *  Vectorized conversion of palette indices through per-channel lookup tables,
+ *  with the implementation picked for the CPU at runtime.
+ **************************************************************************** */
+
+#ifndef __PALETTE_KERNELS_HPP__
+#define __PALETTE_KERNELS_HPP__
+
+#include <cstddef>
+#include "../emucore/m6502/src/bspf/src/bspf.hxx"
+
+/**
+    Lookup kernels over 256-entry byte tables, one table per channel. The vector
+    implementations assume even palette indices, which is all the TIA produces, and
+    take a scalar path for any block of pixels that contains an odd one.
+ */
+struct PaletteKernels {
+    /** dst[i] = table[src[i]] */
+    void (*lookup)(const uInt8* table, const uInt8* src, uInt8* dst, size_t size);
+
+    /** Interleaved RGB, three bytes per pixel */
+    void (*lookupRGB)(const uInt8* red, const uInt8* green, const uInt8* blue,
+                      const uInt8* src, uInt8* dst, size_t size);
+
+    /** Interleaved RGBA, four bytes per pixel with an opaque alpha */
+    void (*lookupRGBA)(const uInt8* red, const uInt8* green, const uInt8* blue,
+                       const uInt8* src, uInt8* dst, size_t size);
+
+    /** dst[i] = table[first[i] * 256 + second[i]], for tables over pairs of indices such
+        as the phosphor blend. The table needs PAIR_TABLE_PADDING bytes after its 65536
+        entries, which gathers may read. */
+    void (*lookupPair)(const uInt8* table, const uInt8* first, const uInt8* second,
+                       uInt8* dst, size_t size);
+
+    /** Instruction set the kernels are written for, e.g. "avx2" */
+    const char* name;
+
+    /** Plain C++ kernels, available everywhere */
+    static const PaletteKernels& portable();
+
+    /** The fastest kernels this CPU supports */
+    static const PaletteKernels& best();
+
+    static const size_t PAIR_TABLE_PADDING = 3;
+};
+
+#endif // __PALETTE_KERNELS_HPP__
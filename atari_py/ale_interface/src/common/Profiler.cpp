@@ -0,0 +1,57 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  Profiler.cpp
+ *
+ *  Per-instance counters of where emulation time goes.
+ **************************************************************************** */
+
+#include "Profiler.hpp"
+#include <cstring>
+#include <sstream>
+
+static const char* PHASE_NAMES[Profiler::NUM_PHASES] = {
+  "cpu", "tia_update", "process_screen", "process_ram", "rom_step",
+  "state_save", "state_load", "palette"
+};
+
+static const char* COUNTER_NAMES[Profiler::NUM_COUNTERS] = {
+  "instructions", "frames", "clones", "restores"
+};
+
+void Profiler::reset() {
+  memset(m_nanoseconds, 0, sizeof(m_nanoseconds));
+  memset(m_calls, 0, sizeof(m_calls));
+  memset(m_counts, 0, sizeof(m_counts));
+}
+
+bool Profiler::enabled() {
+#ifdef __USE_PROFILING
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string Profiler::toJSON() const {
+  std::ostringstream out;
+  out.precision(9);
+  out << "{\"enabled\": " << (enabled() ? "true" : "false") << ", \"phases\": {";
+  for (int p = 0; p < NUM_PHASES; p++) {
+    out << (p > 0 ? ", " : "") << "\"" << PHASE_NAMES[p] << "\": {\"seconds\": "
+        << m_nanoseconds[p] * 1e-9 << ", \"calls\": " << m_calls[p] << "}";
+  }
+  out << "}, \"counts\": {";
+  for (int c = 0; c < NUM_COUNTERS; c++) {
+    out << (c > 0 ? ", " : "") << "\"" << COUNTER_NAMES[c] << "\": " << m_counts[c];
+  }
+  out << "}}";
+  return out.str();
+}
@@ -0,0 +1,103 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  Profiler.hpp
+ *
+ *  Per-instance counters of where emulation time goes. They are only collected
+ *  when built with USE_PROFILING; otherwise the macros below compile to nothing.
+ **************************************************************************** */
+
+#ifndef __PROFILER_HPP__
+#define __PROFILER_HPP__
+
+#include <chrono>
+#include <string>
+#include <stdint.h>
+
+class Profiler {
+  public:
+    /** Phases whose time and number of calls are measured. Phases nest: the TIA's frame
+        updates happen while the CPU executes, and the CPU runs within a ROM step's frame. */
+    enum Phase {
+      CPU,            // M6502::execute, one call per frame
+      TIA_UPDATE,     // TIA::updateFrame, i.e. drawing the scanlines caught up on
+      PROCESS_SCREEN, // StellaEnvironment::processScreen
+      PROCESS_RAM,    // StellaEnvironment::processRAM
+      ROM_STEP,       // RomSettings::step, reading reward and terminal state from RAM
+      STATE_SAVE,     // ALEState::save
+      STATE_LOAD,     // ALEState::load
+      PALETTE,        // Converting screens to grayscale or colour
+      NUM_PHASES
+    };
+
+    /** Events that are only counted */
+    enum Counter {
+      INSTRUCTIONS,   // 6502 instructions executed
+      FRAMES,         // Frames emulated
+      CLONES,         // States cloned through the interface
+      RESTORES,       // States restored through the interface
+      NUM_COUNTERS
+    };
+
+    Profiler() { reset(); }
+
+    /** Zeroes all times and counts */
+    void reset();
+
+    void addCall(Phase phase, uint64_t nanoseconds) {
+      m_nanoseconds[phase] += nanoseconds;
+      m_calls[phase]++;
+    }
+    void add(Counter counter, uint64_t amount) { m_counts[counter] += amount; }
+
+    uint64_t nanoseconds(Phase phase) const { return m_nanoseconds[phase]; }
+    uint64_t calls(Phase phase) const { return m_calls[phase]; }
+    uint64_t count(Counter counter) const { return m_counts[counter]; }
+
+    /** Whether the counters are collected at all, i.e. the build has USE_PROFILING */
+    static bool enabled();
+
+    /** All times (in seconds), calls and counts as a JSON object */
+    std::string toJSON() const;
+
+    /** Times the enclosing scope as one call of the given phase */
+    class Scope {
+      public:
+        Scope(Profiler& profiler, Phase phase):
+          m_profiler(profiler), m_phase(phase), m_start(Clock::now()) {}
+        ~Scope() {
+          m_profiler.addCall(m_phase,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count());
+        }
+
+      private:
+        typedef std::chrono::steady_clock Clock;
+        Profiler& m_profiler;
+        Phase m_phase;
+        Clock::time_point m_start;
+    };
+
+  private:
+    uint64_t m_nanoseconds[NUM_PHASES];
+    uint64_t m_calls[NUM_PHASES];
+    uint64_t m_counts[NUM_COUNTERS];
+};
+
+#ifdef __USE_PROFILING
+#define ALE_PROFILE_SCOPE(profiler, phase) \
+  Profiler::Scope ale_profile_scope((profiler), Profiler::phase)
+#define ALE_PROFILE_COUNT(profiler, counter, amount) \
+  (profiler).add(Profiler::counter, (amount))
+#else
+#define ALE_PROFILE_SCOPE(profiler, phase) do {} while (0)
+#define ALE_PROFILE_COUNT(profiler, counter, amount) do {} while (0)
+#endif
+
+#endif // __PROFILER_HPP__
@@ -0,0 +1,124 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  ThreadPool.cpp
+ *
+ *  A fixed-size pool of worker threads used to step several environments
+ *  in parallel.
+ *
+ **************************************************************************** */
+
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+ThreadPool::ThreadPool(size_t num_threads):
+  m_stopping(false) {
+
+  for (size_t i = 0; i < num_threads; i++)
+    m_workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_task_available.notify_all();
+
+  for (size_t i = 0; i < m_workers.size(); i++)
+    m_workers[i].join();
+}
+
+void ThreadPool::enqueue(const std::function<void()> &task) {
+  if (m_workers.empty()) {
+    task();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(task);
+  }
+  m_task_available.notify_one();
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t)> &fn) {
+  if (m_workers.empty() || n == 1) {
+    for (size_t i = 0; i < n; i++)
+      fn(i);
+    return;
+  }
+
+  // Each runner claims indices until none are left, so uneven step costs
+  // (e.g. one environment resetting) balance out across the workers.
+  struct Job {
+    std::atomic<size_t> next;
+    size_t pending;
+    std::exception_ptr error; // The first exception thrown by fn
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  std::shared_ptr<Job> job(new Job());
+  job->next = 0;
+
+  size_t num_runners = std::min(n, m_workers.size());
+  job->pending = num_runners;
+
+  for (size_t r = 0; r < num_runners; r++) {
+    enqueue([job, n, &fn]() {
+      std::exception_ptr error;
+      try {
+        size_t i;
+        while ((i = job->next++) < n)
+          fn(i);
+      }
+      catch (...) {
+        // An exception can't leave a worker; hand it to the caller instead,
+        // and have the other runners stop claiming indices
+        error = std::current_exception();
+        job->next = n;
+      }
+
+      std::lock_guard<std::mutex> lock(job->mutex);
+      if (error && !job->error)
+        job->error = error;
+      if (--job->pending == 0)
+        job->done.notify_one();
+    });
+  }
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  while (job->pending > 0)
+    job->done.wait(lock);
+
+  if (job->error)
+    std::rethrow_exception(job->error);
+}
+
+void ThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (!m_stopping && m_tasks.empty())
+        m_task_available.wait(lock);
+
+      if (m_tasks.empty())
+        return;
+
+      task = m_tasks.front();
+      m_tasks.pop_front();
+    }
+    task();
+  }
+}
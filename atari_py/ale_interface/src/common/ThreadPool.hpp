@@ -0,0 +1,69 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  ThreadPool.hpp
+ *
+ *  A fixed-size pool of worker threads used to step several environments
+ *  in parallel.
+ *
+ **************************************************************************** */
+
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+class ThreadPool {
+
+    public:
+
+        /** Creates a pool with the given number of workers. With 0 workers, every task
+            runs on the calling thread. */
+        explicit ThreadPool(size_t num_threads);
+
+        /** Waits for the queued tasks to finish, then joins the workers. */
+        ~ThreadPool();
+
+        /** Number of worker threads. */
+        size_t size() const { return m_workers.size(); }
+
+        /** Queues a task; it runs on whichever worker is free first. The task must not
+            throw: nothing on a worker thread could catch it. */
+        void enqueue(const std::function<void()> &task);
+
+        /** Calls fn(i) for every i in [0, n) across the workers, and blocks until all
+            calls have returned. If a call throws, the remaining indices are skipped and
+            the first exception is rethrown here. */
+        void parallelFor(size_t n, const std::function<void(size_t)> &fn);
+
+    private:
+
+        void workerLoop();
+
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()> > m_tasks;
+
+        std::mutex m_mutex;
+        std::condition_variable m_task_available;
+
+        /** Set by the destructor to tell the workers to exit. */
+        bool m_stopping;
+
+        // Disallow copying
+        ThreadPool(const ThreadPool &);
+        ThreadPool &operator=(const ThreadPool &);
+};
+
+#endif // __THREAD_POOL_HPP__
@@ -47,13 +47,16 @@
 #include "CartUA.hxx"
 #include "MD5.hxx"
 #include "Props.hxx"
+#include "RomImage.hxx"
 #include "Settings.hxx"
 using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Cartridge* Cartridge::create(const uInt8* image, uInt32 size,
-    const Properties& properties, const Settings& settings)
+Cartridge* Cartridge::create(const shared_ptr<const RomImage>& rom,
+    const Properties& properties, const Settings& settings, Random& rng)
 {
   Cartridge* cartridge = 0;
+  const uInt8* image = rom->image();
+  uInt32 size = rom->size();
 
   // Get the type of the cartridge we're creating
   const string& md5 = properties.get(Cartridge_MD5);
@@ -78,7 +81,7 @@ Cartridge* Cartridge::create(const uInt8* image, uInt32 size,
   // If we ask for extended info, always do an autodetect
   if(type == "AUTO-DETECT" || settings.getBool("rominfo"))
   {
-    string detected = autodetectType(image, size);
+    const string& detected = rom->detectedType();
     buf << " ==> " << detected;
     if(type != "AUTO-DETECT" && type != detected)
       buf << " (auto-detection not consistent)";
@@ -86,13 +89,20 @@ Cartridge* Cartridge::create(const uInt8* image, uInt32 size,
     type = detected;
   }
   buf << endl;
-  myAboutString = buf.str();
+
+  // A type other than the ROM's own may read past the padded image
+  shared_ptr<const RomImage> padded;
+  if(imageSize(type, size) > rom->imageSize())
+  {
+    padded = rom->padded(imageSize(type, size));
+    image = padded->image();
+  }
 
   // We should know the cart's type by now so let's create it
   if(type == "2K")
     cartridge = new Cartridge2K(image);
   else if(type == "3E")
-    cartridge = new Cartridge3E(image, size);
+    cartridge = new Cartridge3E(image, size, rng);
   else if(type == "3F")
     cartridge = new Cartridge3F(image, size);
   else if(type == "4A50")
@@ -100,37 +110,37 @@ Cartridge* Cartridge::create(const uInt8* image, uInt32 size,
   else if(type == "4K")
     cartridge = new Cartridge4K(image);
   else if(type == "AR")
-    cartridge = new CartridgeAR(image, size, true); //settings.getBool("fastscbios")
+    cartridge = new CartridgeAR(image, size, true, rng); //settings.getBool("fastscbios")
   else if(type == "DPC")
     cartridge = new CartridgeDPC(image, size);
   else if(type == "E0")
     cartridge = new CartridgeE0(image);
   else if(type == "E7")
-    cartridge = new CartridgeE7(image);
+    cartridge = new CartridgeE7(image, rng);
   else if(type == "F4")
     cartridge = new CartridgeF4(image);
   else if(type == "F4SC")
-    cartridge = new CartridgeF4SC(image);
+    cartridge = new CartridgeF4SC(image, rng);
   else if(type == "F6")
     cartridge = new CartridgeF6(image);
   else if(type == "F6SC")
-    cartridge = new CartridgeF6SC(image);
+    cartridge = new CartridgeF6SC(image, rng);
   else if(type == "F8")
     cartridge = new CartridgeF8(image, false);
   else if(type == "F8 swapped")
     cartridge = new CartridgeF8(image, true);
   else if(type == "F8SC")
-    cartridge = new CartridgeF8SC(image);
+    cartridge = new CartridgeF8SC(image, rng);
   else if(type == "FASC")
-    cartridge = new CartridgeFASC(image);
+    cartridge = new CartridgeFASC(image, rng);
   else if(type == "FE")
     cartridge = new CartridgeFE(image);
   else if(type == "MC")
-    cartridge = new CartridgeMC(image, size);
+    cartridge = new CartridgeMC(image, size, rng);
   else if(type == "MB")
     cartridge = new CartridgeMB(image);
   else if(type == "CV")
-    cartridge = new CartridgeCV(image, size);
+    cartridge = new CartridgeCV(image, size, rng);
   else if(type == "UA")
     cartridge = new CartridgeUA(image);
   else if(type == "0840")
@@ -138,6 +148,12 @@ Cartridge* Cartridge::create(const uInt8* image, uInt32 size,
   else
     ale::Logger::Error << "ERROR: Invalid cartridge type " << type << " ..." << endl;
 
+  if(cartridge)
+  {
+    cartridge->myAboutString = buf.str();
+    cartridge->myRomImage = padded ? padded : rom;
+  }
+
   return cartridge;
 }
 
@@ -157,7 +173,7 @@ bool Cartridge::save(ofstream& out)
 {
   int size = -1;
 
-  uInt8* image = getImage(size);
+  const uInt8* image = getImage(size);
   if(image == 0 || size <= 0)
   {
     ale::Logger::Error << "save not supported" << endl;
@@ -170,6 +186,24 @@ bool Cartridge::save(ofstream& out)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt8* Cartridge::unshareImage(const uInt8*& image, uInt32 size)
+{
+  if(myPatchedImage.empty())
+  {
+    myPatchedImage.assign(image, image + size);
+    image = &myPatchedImage[0];
+  }
+
+  return &myPatchedImage[0];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge::heapUsage() const
+{
+  return myPatchedImage.capacity() + myAboutString.capacity();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 string Cartridge::autodetectType(const uInt8* image, uInt32 size)
 {
@@ -283,6 +317,32 @@ string Cartridge::autodetectType(const uInt8* image, uInt32 size)
   return type;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge::imageSize(const string& type, uInt32 size)
+{
+  // The types not listed only read as much as the ROM holds
+  uInt32 banks = 0;
+  if(type == "2K" || type == "CV")
+    banks = 2048;
+  else if(type == "4K")
+    banks = 4096;
+  else if(type == "E0" || type == "F8" || type == "F8 swapped" ||
+          type == "F8SC" || type == "FE" || type == "UA")
+    banks = 8192;
+  else if(type == "DPC")
+    banks = 8192 + 2048;
+  else if(type == "FASC")
+    banks = 12288;
+  else if(type == "E7" || type == "F6" || type == "F6SC")
+    banks = 16384;
+  else if(type == "F4" || type == "F4SC")
+    banks = 32768;
+  else if(type == "MB")
+    banks = 65536;
+
+  return size > banks ? size : banks;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Cartridge::searchForBytes(const uInt8* image, uInt32 imagesize,
                                const uInt8* signature, uInt32 sigsize,
@@ -468,5 +528,3 @@ Cartridge& Cartridge::operator = (const Cartridge&)
   return *this;
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-string Cartridge::myAboutString;
@@ -23,8 +23,12 @@ class Cartridge;
 class System;
 class Properties;
 class Settings;
+class Random;
+class RomImage;
 
 #include <fstream>
+#include <memory>
+#include <vector>
 #include "m6502/src/bspf/src/bspf.hxx"
 #include "m6502/src/Device.hxx"
 #include "../common/Log.hpp"
@@ -43,14 +47,14 @@ class Cartridge : public Device
       Create a new cartridge object allocated on the heap.  The
       type of cartridge created depends on the properties object.
 
-      @param image    A pointer to the ROM image
-      @param size     The size of the ROM image 
+      @param rom      The ROM image, which the cartridge may keep referencing
       @param props    The properties associated with the game
       @param settings The settings associated with the system
+      @param rng      The random number generator used to initialize cart RAM
       @return   Pointer to the new cartridge object allocated on the heap
     */
-    static Cartridge* create(const uInt8* image, uInt32 size, 
-        const Properties& props, const Settings& settings);
+    static Cartridge* create(const std::shared_ptr<const RomImage>& rom,
+        const Properties& props, const Settings& settings, Random& rng);
 
     /**
       Create a new cartridge
@@ -65,7 +69,12 @@ class Cartridge : public Device
     /**
       Query some information about this cartridge.
     */
-    static const std::string& about() { return myAboutString; }
+    const std::string& about() const { return myAboutString; }
+
+    /**
+      Get the ROM image this cartridge was created from.
+    */
+    const std::shared_ptr<const RomImage>& romImage() const { return myRomImage; }
 
     /**
       Save the internal (patched) ROM image.
@@ -120,7 +129,25 @@ class Cartridge : public Device
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size) = 0;
+    virtual const uInt8* getImage(int& size) = 0;
+
+  protected:
+    /**
+      Give the cartridge its own copy of the ROM image it shares with the
+      other cartridges of the same ROM, so that patching it doesn't change
+      them.  The copy is made the first time only.
+
+      @param image  The shared image, which is pointed to the copy
+      @param size   The size of the image
+      @return  The copy, which may be changed
+    */
+    uInt8* unshareImage(const uInt8*& image, uInt32 size);
+
+    /**
+      Get the memory allocated by the Cartridge base class, for the
+      memoryUsage() of derived classes.
+    */
+    uInt32 heapUsage() const;
 
   protected:
     // If bankLocked is true, ignore attempts at bankswitching. This is used
@@ -128,6 +155,8 @@ class Cartridge : public Device
     bool bankLocked;
 
   private:
+    friend class RomImage;
+
     /**
       Try to auto-detect the bankswitching type of the cartridge
 
@@ -137,6 +166,17 @@ class Cartridge : public Device
     */
     static std::string autodetectType(const uInt8* image, uInt32 size);
 
+    /**
+      Get the number of bytes of the ROM image a cartridge of the given
+      type reads, which is more than the ROM holds if the ROM is smaller
+      than the type's banks
+
+      @param type  The bankswitching type of the cartridge
+      @param size  The size of the ROM image
+      @return The number of bytes read
+    */
+    static uInt32 imageSize(const std::string& type, uInt32 size);
+
     /**
       Search the image for the specified byte signature
 
@@ -194,7 +234,13 @@ class Cartridge : public Device
 
   private:
     // Contains info about this cartridge in string format
-    static std::string myAboutString;
+    std::string myAboutString;
+
+    // The ROM image the cartridge was created from, which keeps it in memory
+    std::shared_ptr<const RomImage> myRomImage;
+
+    // The patched copy of the ROM image, if it has been patched
+    std::vector<uInt8> myPatchedImage;
 
     // Copy constructor isn't supported by cartridges so make it private
     Cartridge(const Cartridge&);
@@ -96,8 +96,14 @@ bool Cartridge0840::patch(uInt16 address, uInt8 value)
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge0840::getImage(int& size)
+const uInt8* Cartridge0840::getImage(int& size)
 {
   size = 0;
   return 0;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge0840::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
@@ -26,11 +26,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Cartridge2K::Cartridge2K(const uInt8* image)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 2048; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -152,13 +149,22 @@ int Cartridge2K::bankCount()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Cartridge2K::patch(uInt16 address, uInt8 value)
 {
-  myImage[address & 0x07FF] = value;
+  unshareImage(myImage, 2048)[address & 0x07FF] = value;
+
+  // Map the patched copy in place of the shared image
+  install(*mySystem);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge2K::getImage(int& size)
+const uInt8* Cartridge2K::getImage(int& size)
 {
   size = 2048;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge2K::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
@@ -120,7 +120,13 @@ class Cartridge2K : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -139,8 +145,9 @@ class Cartridge2K : public Cartridge
     virtual void poke(uInt16 address, uInt8 value);
 
   private:
-    // The 2k ROM image for the cartridge
-    uInt8 myImage[2048];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 };
 
 #endif
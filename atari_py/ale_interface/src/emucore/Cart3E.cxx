@@ -27,7 +27,7 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Cartridge3E::Cartridge3E(const uInt8* image, uInt32 size)
+Cartridge3E::Cartridge3E(const uInt8* image, uInt32 size, Random& rng)
   : mySize(size)
 {
   // Allocate array for the ROM image
@@ -40,10 +40,9 @@ Cartridge3E::Cartridge3E(const uInt8* image, uInt32 size)
   }
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
   for(uInt32 i = 0; i < 32768; ++i)
   {
-    myRam[i] = random.next();
+    myRam[i] = rng.next();
   }
 }
 
@@ -154,8 +153,7 @@ bool Cartridge3E::save(Serializer& out)
 
     // Output RAM
     out.putInt(32768);
-    for(uInt32 addr = 0; addr < 32768; ++addr)
-      out.putInt(myRam[addr]);
+    out.putBytes(myRam, 32768);
   }
   catch(const char* msg)
   {
@@ -185,8 +183,7 @@ bool Cartridge3E::load(Deserializer& in)
 
     // Input RAM
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 addr = 0; addr < limit; ++addr)
-      myRam[addr] = (uInt8) in.getInt();
+    in.getBytes(myRam, limit);
   }
   catch(const char* msg)
   {
@@ -303,8 +300,14 @@ bool Cartridge3E::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge3E::getImage(int& size)
+const uInt8* Cartridge3E::getImage(int& size)
 {
   size = mySize;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge3E::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage() + mySize;
+}
@@ -70,8 +70,9 @@ class Cartridge3E : public Cartridge
 
       @param image Pointer to the ROM image
       @param size The size of the ROM image
+      @param rng  The random number generator used to initialize the RAM
     */
-    Cartridge3E(const uInt8* image, uInt32 size);
+    Cartridge3E(const uInt8* image, uInt32 size, Random& rng);
  
     /**
       Destructor
@@ -149,7 +150,13 @@ class Cartridge3E : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -237,8 +237,14 @@ bool Cartridge3F::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge3F::getImage(int& size)
+const uInt8* Cartridge3F::getImage(int& size)
 {
   size = mySize;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge3F::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage() + mySize;
+}
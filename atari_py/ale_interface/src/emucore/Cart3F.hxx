@@ -126,7 +126,13 @@ class Cartridge3F : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -96,8 +96,14 @@ bool Cartridge4A50::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge4A50::getImage(int& size)
+const uInt8* Cartridge4A50::getImage(int& size)
 {
   size = 0;
   return 0;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge4A50::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
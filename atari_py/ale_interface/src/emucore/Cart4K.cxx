@@ -27,11 +27,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Cartridge4K::Cartridge4K(const uInt8* image)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 4096; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -153,13 +150,22 @@ int Cartridge4K::bankCount()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool Cartridge4K::patch(uInt16 address, uInt8 value)
 {
-  myImage[address & 0x0FFF] = value;
+  unshareImage(myImage, 4096)[address & 0x0FFF] = value;
+
+  // Map the patched copy in place of the shared image
+  install(*mySystem);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* Cartridge4K::getImage(int& size)
+const uInt8* Cartridge4K::getImage(int& size)
 {
   size = 4096;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Cartridge4K::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
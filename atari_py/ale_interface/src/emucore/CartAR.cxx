@@ -29,7 +29,7 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeAR::CartridgeAR(const uInt8* image, uInt32 size, bool fastbios)
+CartridgeAR::CartridgeAR(const uInt8* image, uInt32 size, bool fastbios, Random& rng)
   : my6502(0)
 {
   uInt32 i;
@@ -40,11 +40,9 @@ CartridgeAR::CartridgeAR(const uInt8* image, uInt32 size, bool fastbios)
   memcpy(myLoadImages, image, size);
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(i = 0; i < 6 * 1024; ++i)
   {
-    myImage[i] = random.next();
+    myImage[i] = rng.next();
   }
 
   // Initialize SC BIOS ROM
@@ -450,19 +448,16 @@ bool CartridgeAR::save(Serializer& out)
 
     // The 6K of RAM and 2K of ROM contained in the Supercharger
     out.putInt(8192);
-    for(i = 0; i < 8192; ++i)
-      out.putInt(myImage[i]);
+    out.putBytes(myImage, 8192);
 
     // The 256 byte header for the current 8448 byte load
     out.putInt(256);
-    for(i = 0; i < 256; ++i)
-      out.putInt(myHeader[i]);
+    out.putBytes(myHeader, 256);
 
     // All of the 8448 byte loads associated with the game 
     // Note that the size of this array is myNumberOfLoadImages * 8448
     out.putInt(myNumberOfLoadImages * 8448);
-    for(i = 0; i < (uInt32) myNumberOfLoadImages * 8448; ++i)
-      out.putInt(myLoadImages[i]);
+    out.putBytes(myLoadImages, (uInt32) myNumberOfLoadImages * 8448);
 
     // Indicates how many 8448 loads there are
     out.putInt(myNumberOfLoadImages);
@@ -518,19 +513,16 @@ bool CartridgeAR::load(Deserializer& in)
 
     // The 6K of RAM and 2K of ROM contained in the Supercharger
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myImage[i] = (uInt8) in.getInt();
+    in.getBytes(myImage, limit);
 
     // The 256 byte header for the current 8448 byte load
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myHeader[i] = (uInt8) in.getInt();
+    in.getBytes(myHeader, limit);
 
     // All of the 8448 byte loads associated with the game 
     // Note that the size of this array is myNumberOfLoadImages * 8448
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myLoadImages[i] = (uInt8) in.getInt();
+    in.getBytes(myLoadImages, limit);
 
     // Indicates how many 8448 loads there are
     myNumberOfLoadImages = (uInt8) in.getInt();
@@ -595,8 +587,14 @@ bool CartridgeAR::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeAR::getImage(int& size)
+const uInt8* CartridgeAR::getImage(int& size)
 {
   size = myNumberOfLoadImages * 8448;
   return &myLoadImages[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeAR::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage() + myNumberOfLoadImages * 8448;
+}
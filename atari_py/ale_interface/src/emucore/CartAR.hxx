@@ -48,8 +48,9 @@ class CartridgeAR : public Cartridge
       @param image     Pointer to the ROM image
       @param size      The size of the ROM image
       @param fastbios  Whether or not to quickly execute the BIOS code
+      @param rng       The random number generator used to initialize the RAM
     */
-    CartridgeAR(const uInt8* image, uInt32 size, bool fastbios);
+    CartridgeAR(const uInt8* image, uInt32 size, bool fastbios, Random& rng);
 
     /**
       Destructor
@@ -134,7 +135,13 @@ class CartridgeAR : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -26,7 +26,7 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeCV::CartridgeCV(const uInt8* image, uInt32 size)
+CartridgeCV::CartridgeCV(const uInt8* image, uInt32 size, Random& rng)
 {
   uInt32 addr;
   if(size == 2048)
@@ -38,11 +38,9 @@ CartridgeCV::CartridgeCV(const uInt8* image, uInt32 size)
     }
 
     // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
     for(uInt32 i = 0; i < 1024; ++i)
     {
-      myRAM[i] = random.next();
+      myRAM[i] = rng.next();
     }
   }
   else if(size == 4096)
@@ -144,8 +142,7 @@ bool CartridgeCV::save(Serializer& out)
 
     // Output RAM
     out.putInt(1024);
-    for(uInt32 addr = 0; addr < 1024; ++addr)
-      out.putInt(myRAM[addr]);
+    out.putBytes(myRAM, 1024);
   }
   catch(const char* msg)
   {
@@ -173,8 +170,7 @@ bool CartridgeCV::load(Deserializer& in)
 
     // Input RAM
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 addr = 0; addr < limit; ++addr)
-      myRAM[addr] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -217,8 +213,14 @@ bool CartridgeCV::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeCV::getImage(int& size)
+const uInt8* CartridgeCV::getImage(int& size)
 {
   size = 2048;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeCV::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
@@ -43,8 +43,9 @@ class CartridgeCV : public Cartridge
       Create a new cartridge using the specified image
 
       @param image Pointer to the ROM image
+      @param rng   The random number generator used to initialize the RAM
     */
-    CartridgeCV(const uInt8* image, uInt32 size);
+    CartridgeCV(const uInt8* image, uInt32 size, Random& rng);
 
     /**
       Destructor
@@ -122,7 +123,13 @@ class CartridgeCV : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -444,13 +444,11 @@ bool CartridgeDPC::save(Serializer& out)
 
     // The top registers for the data fetchers
     out.putInt(8);
-    for(i = 0; i < 8; ++i)
-      out.putInt(myTops[i]);
+    out.putBytes(myTops, 8);
 
     // The bottom registers for the data fetchers
     out.putInt(8);
-    for(i = 0; i < 8; ++i)
-      out.putInt(myBottoms[i]);
+    out.putBytes(myBottoms, 8);
 
     // The counter registers for the data fetchers
     out.putInt(8);
@@ -459,8 +457,7 @@ bool CartridgeDPC::save(Serializer& out)
 
     // The flag registers for the data fetchers
     out.putInt(8);
-    for(i = 0; i < 8; ++i)
-      out.putInt(myFlags[i]);
+    out.putBytes(myFlags, 8);
 
     // The music mode flags for the data fetchers
     out.putInt(3);
@@ -504,13 +501,11 @@ bool CartridgeDPC::load(Deserializer& in)
 
     // The top registers for the data fetchers
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myTops[i] = (uInt8) in.getInt();
+    in.getBytes(myTops, limit);
 
     // The bottom registers for the data fetchers
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myBottoms[i] = (uInt8) in.getInt();
+    in.getBytes(myBottoms, limit);
 
     // The counter registers for the data fetchers
     limit = (uInt32) in.getInt();
@@ -519,8 +514,7 @@ bool CartridgeDPC::load(Deserializer& in)
 
     // The flag registers for the data fetchers
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myFlags[i] = (uInt8) in.getInt();
+    in.getBytes(myFlags, limit);
 
     // The music mode flags for the data fetchers
     limit = (uInt32) in.getInt();
@@ -597,7 +591,7 @@ bool CartridgeDPC::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeDPC::getImage(int& size)
+const uInt8* CartridgeDPC::getImage(int& size)
 {
   size = 8192 + 2048 + 255;
 
@@ -610,3 +604,9 @@ uInt8* CartridgeDPC::getImage(int& size)
 
   return &myImageCopy[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeDPC::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
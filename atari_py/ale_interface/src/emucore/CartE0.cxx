@@ -27,11 +27,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CartridgeE0::CartridgeE0(const uInt8* image)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 8192; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -237,6 +234,11 @@ bool CartridgeE0::load(Deserializer& in)
     uInt32 limit = (uInt32) in.getInt();
     for(uInt32 i = 0; i < limit; ++i)
       myCurrentSlice[i] = (uInt16) in.getInt();
+
+    // Map the restored slices back into the address space
+    segmentZero(myCurrentSlice[0]);
+    segmentOne(myCurrentSlice[1]);
+    segmentTwo(myCurrentSlice[2]);
   }
   catch(const char* msg)
   {
@@ -276,13 +278,27 @@ int CartridgeE0::bankCount()
 bool CartridgeE0::patch(uInt16 address, uInt8 value)
 {
   address = address & 0x0FFF;
-  myImage[(myCurrentSlice[address >> 10] << 10) + (address & 0x03FF)] = value;
+  uInt16 slices[3] = { myCurrentSlice[0], myCurrentSlice[1], myCurrentSlice[2] };
+  uInt8* image = unshareImage(myImage, 8192);
+  image[(myCurrentSlice[address >> 10] << 10) + (address & 0x03FF)] = value;
+
+  // Map the patched copy in place of the shared image
+  install(*mySystem);
+  segmentZero(slices[0]);
+  segmentOne(slices[1]);
+  segmentTwo(slices[2]);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeE0::getImage(int& size)
+const uInt8* CartridgeE0::getImage(int& size)
 {
   size = 8192;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeE0::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
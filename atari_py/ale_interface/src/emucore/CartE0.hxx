@@ -124,7 +124,13 @@ class CartridgeE0 : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -168,8 +174,9 @@ class CartridgeE0 : public Cartridge
     // Indicates the slice mapped into each of the four segments
     uInt16 myCurrentSlice[4];
 
-    // The 8K ROM image of the cartridge
-    uInt8 myImage[8192];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 };
 
 #endif
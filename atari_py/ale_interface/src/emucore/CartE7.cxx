@@ -26,7 +26,7 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeE7::CartridgeE7(const uInt8* image)
+CartridgeE7::CartridgeE7(const uInt8* image, Random& rng)
 {
   // Copy the ROM image into my buffer
   for(uInt32 addr = 0; addr < 16384; ++addr)
@@ -35,11 +35,9 @@ CartridgeE7::CartridgeE7(const uInt8* image)
   }
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(uInt32 i = 0; i < 2048; ++i)
   {
-    myRAM[i] = random.next();
+    myRAM[i] = rng.next();
   }
 }
 
@@ -189,8 +187,7 @@ bool CartridgeE7::save(Serializer& out)
 
     // The 2048 bytes of RAM
     out.putInt(2048);
-    for(i = 0; i < 2048; ++i)
-      out.putInt(myRAM[i]);
+    out.putBytes(myRAM, 2048);
   }
   catch(const char* msg)
   {
@@ -226,8 +223,7 @@ bool CartridgeE7::load(Deserializer& in)
 
     // The 2048 bytes of RAM
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myRAM[i] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -318,8 +314,14 @@ bool CartridgeE7::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeE7::getImage(int& size)
+const uInt8* CartridgeE7::getImage(int& size)
 {
   size = 16384;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeE7::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
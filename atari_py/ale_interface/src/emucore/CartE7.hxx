@@ -62,8 +62,9 @@ class CartridgeE7 : public Cartridge
       Create a new cartridge using the specified image
 
       @param image Pointer to the ROM image
+      @param rng   The random number generator used to initialize the RAM
     */
-    CartridgeE7(const uInt8* image);
+    CartridgeE7(const uInt8* image, Random& rng);
  
     /**
       Destructor
@@ -141,7 +142,13 @@ class CartridgeE7 : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
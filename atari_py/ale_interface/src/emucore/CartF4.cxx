@@ -27,11 +27,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CartridgeF4::CartridgeF4(const uInt8* image)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 32768; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -198,13 +195,20 @@ int CartridgeF4::bankCount()
 bool CartridgeF4::patch(uInt16 address, uInt8 value)
 {
   address = address & 0x0FFF;
-  myImage[myCurrentBank * 4096 + address] = value;
+  unshareImage(myImage, 32768)[myCurrentBank * 4096 + address] = value;
+  bank(myCurrentBank);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeF4::getImage(int& size)
+const uInt8* CartridgeF4::getImage(int& size)
 {
   size = 32768;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeF4::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
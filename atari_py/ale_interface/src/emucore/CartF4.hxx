@@ -119,7 +119,13 @@ class CartridgeF4 : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -141,8 +147,9 @@ class CartridgeF4 : public Cartridge
     // Indicates which bank is currently active
     uInt16 myCurrentBank;
 
-    // The 16K ROM image of the cartridge
-    uInt8 myImage[32768];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 };
 
 #endif
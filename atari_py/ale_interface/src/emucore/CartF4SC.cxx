@@ -26,20 +26,15 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeF4SC::CartridgeF4SC(const uInt8* image)
+CartridgeF4SC::CartridgeF4SC(const uInt8* image, Random& rng)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 32768; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(uInt32 i = 0; i < 128; ++i)
   {
-    myRAM[i] = random.next();
+    myRAM[i] = rng.next();
   }
 }
 
@@ -147,8 +142,7 @@ bool CartridgeF4SC::save(Serializer& out)
 
     // The 128 bytes of RAM
     out.putInt(128);
-    for(uInt32 i = 0; i < 128; ++i)
-      out.putInt(myRAM[i]);
+    out.putBytes(myRAM, 128);
   }
   catch(const char* msg)
   {
@@ -177,8 +171,7 @@ bool CartridgeF4SC::load(Deserializer& in)
     myCurrentBank = (uInt16) in.getInt();
 
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 i = 0; i < limit; ++i)
-      myRAM[i] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -238,13 +231,20 @@ int CartridgeF4SC::bankCount()
 bool CartridgeF4SC::patch(uInt16 address, uInt8 value)
 {
   address = address & 0x0FFF;
-  myImage[myCurrentBank * 4096 + address] = value;
+  unshareImage(myImage, 32768)[myCurrentBank * 4096 + address] = value;
+  bank(myCurrentBank);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeF4SC::getImage(int& size)
+const uInt8* CartridgeF4SC::getImage(int& size)
 {
   size = 32768;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeF4SC::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
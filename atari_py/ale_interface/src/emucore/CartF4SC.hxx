@@ -40,8 +40,9 @@ class CartridgeF4SC : public Cartridge
       Create a new cartridge using the specified image
 
       @param image Pointer to the ROM image
+      @param rng   The random number generator used to initialize the RAM
     */
-    CartridgeF4SC(const uInt8* image);
+    CartridgeF4SC(const uInt8* image, Random& rng);
  
     /**
       Destructor
@@ -119,7 +120,13 @@ class CartridgeF4SC : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -141,8 +148,9 @@ class CartridgeF4SC : public Cartridge
     // Indicates which bank is currently active
     uInt16 myCurrentBank;
 
-    // The 16K ROM image of the cartridge
-    uInt8 myImage[32768];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 
     // The 128 bytes of RAM
     uInt8 myRAM[128];
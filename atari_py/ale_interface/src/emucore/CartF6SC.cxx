@@ -26,20 +26,15 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeF6SC::CartridgeF6SC(const uInt8* image)
+CartridgeF6SC::CartridgeF6SC(const uInt8* image, Random& rng)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 16384; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(uInt32 i = 0; i < 128; ++i)
   {
-    myRAM[i] = random.next();
+    myRAM[i] = rng.next();
   }
 }
 
@@ -191,8 +186,7 @@ bool CartridgeF6SC::save(Serializer& out)
 
     // The 128 bytes of RAM
     out.putInt(128);
-    for(uInt32 i = 0; i < 128; ++i)
-      out.putInt(myRAM[i]);
+    out.putBytes(myRAM, 128);
 
   }
   catch(const char* msg)
@@ -223,8 +217,7 @@ bool CartridgeF6SC::load(Deserializer& in)
 
     // The 128 bytes of RAM
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 i = 0; i < limit; ++i)
-      myRAM[i] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -284,13 +277,20 @@ int CartridgeF6SC::bankCount()
 bool CartridgeF6SC::patch(uInt16 address, uInt8 value)
 {
   address = address & 0x0FFF;
-  myImage[myCurrentBank * 4096 + address] = value;
+  unshareImage(myImage, 16384)[myCurrentBank * 4096 + address] = value;
+  bank(myCurrentBank);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeF6SC::getImage(int& size)
+const uInt8* CartridgeF6SC::getImage(int& size)
 {
   size = 16384;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeF6SC::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
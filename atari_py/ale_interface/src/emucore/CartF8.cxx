@@ -27,11 +27,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CartridgeF8::CartridgeF8(const uInt8* image, bool swapbanks)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 8192; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 
   // Normally bank 1 is the reset bank, unless we're dealing with ROMs
   // that have been incorrectly created with banks in the opposite order
@@ -223,14 +220,20 @@ int CartridgeF8::bankCount()
 bool CartridgeF8::patch(uInt16 address, uInt8 value)
 {
   address &= 0xfff;
-  myImage[myCurrentBank * 4096 + address] = value;
+  unshareImage(myImage, 8192)[myCurrentBank * 4096 + address] = value;
   bank(myCurrentBank);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeF8::getImage(int& size)
+const uInt8* CartridgeF8::getImage(int& size)
 {
   size = 8192;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeF8::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
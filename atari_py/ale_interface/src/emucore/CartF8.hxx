@@ -120,7 +120,13 @@ class CartridgeF8 : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -145,8 +151,9 @@ class CartridgeF8 : public Cartridge
     // Indicates the bank to use when resetting
     uInt16 myResetBank;
 
-    // The 8K ROM image of the cartridge
-    uInt8 myImage[8192];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 };
 
 #endif
@@ -26,20 +26,15 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeFASC::CartridgeFASC(const uInt8* image)
+CartridgeFASC::CartridgeFASC(const uInt8* image, Random& rng)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 12288; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(uInt32 i = 0; i < 256; ++i)
   {
-    myRAM[i] = random.next();
+    myRAM[i] = rng.next();
   }
 }
  
@@ -181,8 +176,7 @@ bool CartridgeFASC::save(Serializer& out)
 
     // The 256 bytes of RAM
     out.putInt(256);
-    for(uInt32 i = 0; i < 256; ++i)
-      out.putInt(myRAM[i]);
+    out.putBytes(myRAM, 256);
   }
   catch(const char* msg)
   {
@@ -211,8 +205,7 @@ bool CartridgeFASC::load(Deserializer& in)
     myCurrentBank = (uInt16) in.getInt();
 
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 i = 0; i < limit; ++i)
-      myRAM[i] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -272,13 +265,20 @@ int CartridgeFASC::bankCount()
 bool CartridgeFASC::patch(uInt16 address, uInt8 value)
 {
   address = address & 0x0FFF;
-  myImage[myCurrentBank * 4096 + address] = value;
+  unshareImage(myImage, 12288)[myCurrentBank * 4096 + address] = value;
+  bank(myCurrentBank);
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeFASC::getImage(int& size)
+const uInt8* CartridgeFASC::getImage(int& size)
 {
   size = 12288;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeFASC::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
@@ -40,8 +40,9 @@ class CartridgeFASC : public Cartridge
       Create a new cartridge using the specified image
 
       @param image Pointer to the ROM image
+      @param rng   The random number generator used to initialize the RAM
     */
-    CartridgeFASC(const uInt8* image);
+    CartridgeFASC(const uInt8* image, Random& rng);
  
     /**
       Destructor
@@ -119,7 +120,13 @@ class CartridgeFASC : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -141,8 +148,9 @@ class CartridgeFASC : public Cartridge
     // Indicates which bank is currently active
     uInt16 myCurrentBank;
 
-    // The 12K ROM image of the cartridge
-    uInt8 myImage[12288];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
 
     // The 256 bytes of RAM on the cartridge
     uInt8 myRAM[256];
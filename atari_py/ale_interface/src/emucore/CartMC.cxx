@@ -26,7 +26,7 @@
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-CartridgeMC::CartridgeMC(const uInt8* image, uInt32 size)
+CartridgeMC::CartridgeMC(const uInt8* image, uInt32 size, Random& rng)
   : mySlot3Locked(false)
 {
   uInt32 i;
@@ -38,11 +38,9 @@ CartridgeMC::CartridgeMC(const uInt8* image, uInt32 size)
   myRAM = new uInt8[32 * 1024];
 
   // Initialize RAM with random values
-  class Random& random = Random::getInstance();
-
   for(i = 0; i < 32 * 1024; ++i)
   {
-    myRAM[i] = random.next();
+    myRAM[i] = rng.next();
   }
 
   // Allocate array for the ROM image
@@ -238,8 +236,7 @@ bool CartridgeMC::save(Serializer& out)
 
     // The 32K of RAM
     out.putInt(32 * 1024);
-    for(i = 0; i < 32 * 1024; ++i)
-      out.putInt(myRAM[i]);
+    out.putBytes(myRAM, 32 * 1024);
   }
   catch(const char* msg)
   {
@@ -275,8 +272,7 @@ bool CartridgeMC::load(Deserializer& in)
 
     // The 32K of RAM
     limit = (uInt32) in.getInt();
-    for(i = 0; i < limit; ++i)
-      myRAM[i] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
   }
   catch(const char* msg)
   {
@@ -320,8 +316,14 @@ bool CartridgeMC::patch(uInt16 address, uInt8 value)
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeMC::getImage(int& size)
+const uInt8* CartridgeMC::getImage(int& size)
 {
   size = 128 * 1024; // FIXME: keep track of original size
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeMC::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage() + 32 * 1024 + 128 * 1024;
+}
@@ -147,8 +147,9 @@ class CartridgeMC : public Cartridge
 
       @param image Pointer to the ROM image
       @param size The size of the ROM image
+      @param rng  The random number generator used to initialize the RAM
     */
-    CartridgeMC(const uInt8* image, uInt32 size);
+    CartridgeMC(const uInt8* image, uInt32 size, Random& rng);
  
     /**
       Destructor
@@ -226,7 +227,13 @@ class CartridgeMC : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
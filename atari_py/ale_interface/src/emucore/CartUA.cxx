@@ -27,11 +27,8 @@ using namespace std;
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 CartridgeUA::CartridgeUA(const uInt8* image)
 {
-  // Copy the ROM image into my buffer
-  for(uInt32 addr = 0; addr < 8192; ++addr)
-  {
-    myImage[addr] = image[addr];
-  }
+  // Reference the ROM image, which outlives the cartridge
+  myImage = image;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -232,14 +229,20 @@ int CartridgeUA::bankCount()
 bool CartridgeUA::patch(uInt16 address, uInt8 value)
 {
   address &= 0x0fff;
-  myImage[myCurrentBank * 4096] = value;
+  unshareImage(myImage, 8192)[myCurrentBank * 4096] = value;
   bank(myCurrentBank); // TODO: see if this is really necessary
   return true;
 } 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8* CartridgeUA::getImage(int& size)
+const uInt8* CartridgeUA::getImage(int& size)
 {
   size = 8192;
   return &myImage[0];
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 CartridgeUA::memoryUsage() const
+{
+  return sizeof(*this) + heapUsage();
+}
@@ -120,7 +120,13 @@ class CartridgeUA : public Cartridge
       @param size  Set to the size of the internal ROM image data
       @return  A pointer to the internal ROM image data
     */
-    virtual uInt8* getImage(int& size);
+    virtual const uInt8* getImage(int& size);
+
+    /**
+      Get the memory used by the cartridge, not counting the ROM image
+      it shares with the other cartridges of the same ROM.
+    */
+    virtual uInt32 memoryUsage() const;
 
   public:
     /**
@@ -142,8 +148,9 @@ class CartridgeUA : public Cartridge
     // Indicates which bank is currently active
     uInt16 myCurrentBank;
 
-    // The 8K ROM image of the cartridge
-    uInt8 myImage[8192];
+    // The ROM image of the cartridge, shared with the other cartridges of
+    // the same ROM until it is patched
+    const uInt8* myImage;
    
     // Previous Device's page access
     System::PageAccess myHotSpotPageAccess;
@@ -34,6 +34,8 @@
 #include "Keyboard.hxx"
 #include "M6502Hi.hxx"
 #include "M6502Low.hxx"
+#include "M6502Fast.hxx"
+#include "M6502Block.hxx"
 #include "M6532.hxx"
 #include "MediaSrc.hxx"
 #include "Paddles.hxx"
@@ -147,17 +149,31 @@ Console::Console(OSystem* osystem, Cartridge* cart, const Properties& props)
   // Create switches for the console
   mySwitches = new Switches(*myEvent, myProperties);
 
-  // Now, we can construct the system and components
-  mySystem = new System(13, 6);
+  // Now, we can construct the system and components.  Small pages leave
+  // only the bank switching hot spots themselves to the cartridge's peek().
+  // The devices already map their ROM and RAM directly; what still goes
+  // through peek() and poke() are the TIA and RIOT registers, about 10% of
+  // accesses, and FE and MC cartridges, which watch every access
+  mySystem = new System(13, 4);
 
   // Inform the controllers about the system
   myControllers[0]->setSystem(mySystem);
   myControllers[1]->setSystem(mySystem);
 
   M6502* m6502;
-  if(myOSystem->settings().getString("cpu") == "low") {
+  const string& cpu = myOSystem->settings().getString("cpu");
+  if(cpu == "low") {
     m6502 = new M6502Low(1);
   }
+#ifdef THREADED_DISPATCH_SUPPORT
+  // The Supercharger counts the distinct accesses of M6502High
+  else if(cpu == "fast" && string(cart->name()) != "CartridgeAR") {
+    m6502 = new M6502Fast(1);
+  }
+  else if(cpu == "block" && string(cart->name()) != "CartridgeAR") {
+    m6502 = new M6502Block(1);
+  }
+#endif
   else {
     m6502 = new M6502High(1);
   }
@@ -196,7 +212,9 @@ Console::Console(OSystem* osystem, Cartridge* cart, const Properties& props)
     // the second 30 (useful to get past SuperCharger BIOS)
     // Unfortunately, this means we have to always enable 'fastscbios',
     // since otherwise the BIOS loading will take over 250 frames!
+    // ALE: the frames only count scanlines, so they aren't drawn
     mySystem->reset();
+    tia->enableRendering(false);
     int palCount = 0;
     for(int i = 0; i < 60; ++i)
     {
@@ -204,6 +222,7 @@ Console::Console(OSystem* osystem, Cartridge* cart, const Properties& props)
       if(i >= 30 && myMediaSource->scanlines() > 285)
         ++palCount;
     }
+    tia->enableRendering(true);
 
     myDisplayFormat = (palCount >= 15) ? "PAL" : "NTSC";
     if(myProperties.get(Display_Format) == "AUTO-DETECT")
@@ -334,6 +353,23 @@ void Console::setProperties(const Properties& props)
   myProperties = props;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Console::memoryUsage() const
+{
+  uInt32 usage = sizeof(*this) + mySystem->memoryUsage() + sizeof(Switches) +
+      myAboutString.capacity() + myDisplayFormat.capacity();
+
+  // Controllers are counted at the size of their base class
+  for(int i = 0; i < 2; ++i)
+    if(myControllers[i] != 0)
+      usage += sizeof(Controller);
+
+  for(int i = 0; i < LastPropType; ++i)
+    usage += myProperties.get((PropertyType)i).capacity();
+
+  return usage;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Console::initializeVideo(bool full)
 {
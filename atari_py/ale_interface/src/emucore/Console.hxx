@@ -137,6 +137,14 @@ class Console
     */
     const std::string& about() const { return myAboutString; }
 
+    /**
+      Get the memory used by the console, its system, switches and
+      controllers, but not by the devices and processor of the system.
+
+      @return The number of bytes used
+    */
+    uInt32 memoryUsage() const;
+
   public:
     /**
       Overloaded assignment operator
@@ -17,37 +17,57 @@
 //============================================================================
 
 #include "Deserializer.hxx"
-#include <sstream>
+#include <cstring>
 using namespace std;
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Deserializer::Deserializer(const string stream_str):
-myStream(stream_str) {
-    
+Deserializer::Deserializer(const string& data, bool compact):
+myData(data.data()),
+mySize(data.size()),
+myPos(0),
+myCompact(compact) {
 }
 
-
-
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Deserializer::close(void)
 {
-  myStream.clear();
+  myPos = mySize;
 }
 
-
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Deserializer::need(size_t count)
+{
+  if(mySize - myPos < count)
+    throw "Deserializer: end of file";
+}
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Deserializer::getInt(void)
 {
-  if(myStream.eof())
-    throw "Deserializer: end of file";
+  if(myCompact)
+  {
+    uInt32 bits = 0;
+    for(int shift = 0; ; shift += 7)
+    {
+      need(1);
+      if(shift > 28)
+        throw "Deserializer: data corruption";
+
+      uInt8 byte = (uInt8) myData[myPos++];
+      bits |= (uInt32)(byte & 0x7f) << shift;
+      if((byte & 0x80) == 0)
+        break;
+    }
+    return (int)(bits >> 1) ^ -(int)(bits & 1);
+  }
+
+  need(4);
 
   int val = 0;
-  unsigned char buf[4];
-  myStream.read((char*)buf, 4);
+  const unsigned char* buf = (const unsigned char*)myData + myPos;
   for(int i = 0; i < 4; ++i)
     val += (int)(buf[i]) << (i<<3);
+  myPos += 4;
 
   return val;
 }
@@ -56,12 +76,12 @@ int Deserializer::getInt(void)
 string Deserializer::getString(void)
 {
   int len = getInt();
-  string str;
-  str.resize((string::size_type)len);
-  myStream.read(&str[0], (streamsize)len);
+  if(len < 0)
+    throw "Deserializer: data corruption";
+  need(len);
 
-  if(myStream.bad())
-    throw "Deserializer: file read failed";
+  string str(myData + myPos, (string::size_type)len);
+  myPos += len;
 
   return str;
 }
@@ -71,13 +91,39 @@ bool Deserializer::getBool(void)
 {
   bool result = false;
 
-  int b = getInt();
-  if(b == (int)TruePattern)
+  int b = myCompact ? getByte() : getInt();
+  if(b == (myCompact ? 1 : (int)TruePattern))
     result = true;
-  else if(b == (int)FalsePattern)
+  else if(b == (myCompact ? 0 : (int)FalsePattern))
     result = false;
   else
     throw "Deserializer: data corruption";
 
   return result;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt8 Deserializer::getByte(void)
+{
+  if(!myCompact)
+    return (uInt8) getInt();
+
+  need(1);
+  return (uInt8) myData[myPos++];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Deserializer::getBytes(uInt8* values, uInt32 count)
+{
+  if(myCompact)
+  {
+    need(count);
+    memcpy(values, myData + myPos, count);
+    myPos += count;
+  }
+  else
+  {
+    for(uInt32 i = 0; i < count; ++i)
+      values[i] = (uInt8) getInt();
+  }
+}
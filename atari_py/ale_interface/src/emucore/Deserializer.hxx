@@ -19,7 +19,7 @@
 #ifndef DESERIALIZER_HXX
 #define DESERIALIZER_HXX
 
-#include <sstream>
+#include <string>
 #include "m6502/src/bspf/src/bspf.hxx"
 
 /**
@@ -35,15 +35,20 @@
  
  Revised for ALE on Sep 20, 2009
  The new version uses a stringstream (not a file stream)
- 
- TODO: don't copy the whole streams. 
+
+ Revised for ALE again: data is read in place from the given string,
+ which must outlive the Deserializer.  See Serializer for the compact
+ format.
  */
 class Deserializer {
     public:
         /**
          Creates a new Deserializer device.
+
+         @param data    The serialized data
+         @param compact Whether the data is in the compact format
          */
-        Deserializer(const std::string stream_str);
+        Deserializer(const std::string& data, bool compact = false);
         
         void close(void);
 
@@ -67,11 +72,34 @@ class Deserializer {
          @result The boolean value which has been read from the stream.
          */
         bool getBool(void);
+
+        /**
+         Reads a byte value from the current input stream.
+
+         @result The byte value which has been read from the stream.
+         */
+        uInt8 getByte(void);
+
+        /**
+         Reads an array of bytes from the current input stream.
+
+         @param values Where to store the bytes
+         @param count  The number of bytes to read
+         */
+        void getBytes(uInt8* values, uInt32 count);
         
         bool isOpen(void) {return true;}
     private:
-        // The stream to get the deserialized data from.
-        std::stringstream myStream;
+        // Throws unless count more bytes can be read
+        void need(size_t count);
+
+        // The data to get the deserialized values from.
+        const char* myData;
+        size_t mySize;
+        size_t myPos;
+
+        // Whether the data is in the compact format
+        bool myCompact;
         
         enum {
             TruePattern  = 0xfab1fab2,
@@ -330,8 +330,7 @@ bool M6532::save(Serializer& out)
 
     // Output the RAM
     out.putInt(128);
-    for(uInt32 t = 0; t < 128; ++t)
-      out.putInt(myRAM[t]);
+    out.putBytes(myRAM, 128);
 
     out.putInt(myTimer);
     out.putInt(myIntervalShift);
@@ -367,8 +366,7 @@ bool M6532::load(Deserializer& in)
 
     // Input the RAM
     uInt32 limit = (uInt32) in.getInt();
-    for(uInt32 t = 0; t < limit; ++t)
-      myRAM[t] = (uInt8) in.getInt();
+    in.getBytes(myRAM, limit);
 
     myTimer = (uInt32) in.getInt();
     myIntervalShift = (uInt32) in.getInt();
@@ -393,6 +391,12 @@ bool M6532::load(Deserializer& in)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 M6532::memoryUsage() const
+{
+  return sizeof(*this);
+}
+
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 M6532::M6532(const M6532& c)
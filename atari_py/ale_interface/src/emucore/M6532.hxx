@@ -93,6 +93,13 @@ class M6532 : public Device
     */
     virtual bool load(Deserializer& in);
 
+    /**
+      Get the memory used by the device.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
    public:
     /**
       Get the byte at the specified address
@@ -109,6 +116,14 @@ class M6532 : public Device
     */
     virtual void poke(uInt16 address, uInt8 value);
 
+    /**
+      Get the raw value of the interval timer.  Right after a reset this
+      is the random value the timer was started with.
+
+      @return The timer value
+    */
+    uInt32 timer() const { return myTimer; }
+
   private:
     // Reference to the console
     const Console& myConsole;
@@ -114,6 +114,32 @@ class MediaSource
     */
     virtual uInt32 scanlines() const = 0;
 
+    /**
+      Answers whether the last update stopped before the frame was
+      finished, in which case the next update continues that frame.
+
+      @return True if the current frame is only partially emulated
+    */
+    virtual bool partialFrame() const = 0;
+
+    /**
+      Enables or disables drawing frames into the frame buffers. Frames
+      that are not drawn are emulated exactly, but leave both frame buffers
+      untouched. The setting takes effect from the next frame on.
+
+      @param enable Whether frames should be drawn
+    */
+    virtual void enableRendering(bool enable) = 0;
+
+    /**
+      Copies what the saved state of a media source of the same kind
+      leaves out: both frame buffers, how far the current frame got, and
+      the object graphics in use.
+
+      @param source The media source to copy
+    */
+    virtual void copyFrameState(const MediaSource& source) = 0;
+
     /**
       Sets the sound device for the TIA.
     */
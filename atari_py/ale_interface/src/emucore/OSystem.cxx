@@ -20,7 +20,6 @@
 #include <sstream>
 #include <fstream>
 #include <iostream>
-#include <zlib.h>
 #include <string.h>
 using namespace std;
 
@@ -33,15 +32,13 @@ using namespace std;
 #endif
 
 #include "FSNode.hxx"
-#include "MD5.hxx"
 #include "Settings.hxx"
 #include "PropsSet.hxx"
+#include "RomImage.hxx"
 #include "Event.hxx"
 #include "OSystem.hxx"
 #include "SoundSDL.hxx"
 
-#define MAX_ROM_SIZE  512 * 1024
-
 #include <time.h>
 
 #include "bspf.hxx"
@@ -132,8 +129,11 @@ bool OSystem::create()
   // Create the streamer used for accessing eventstreams/recordings
   // Create the event object which will be used for this handler
   myEvent = new Event();
-  // Create a properties set for us to use and set it up
-  myPropSet = new PropertiesSet(this);
+  // The properties set is created when a ROM is first opened, so that
+  // it reads the properties file the settings name by then
+  if (myPropSet != NULL)
+    delete myPropSet;
+  myPropSet = NULL;
 
 #ifdef CHEATCODE_SUPPORT
   myCheatManager = new CheatManager(this);
@@ -160,16 +160,29 @@ bool OSystem::create()
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+PropertiesSet& OSystem::propSet()
+{
+  if (myPropSet == NULL)
+    myPropSet = new PropertiesSet(this);
+
+  return *myPropSet;
+}
+
 void OSystem::resetRNGSeed() {
 
   // We seed the random number generator. The 'time' seed is somewhat redundant, since the
   // rng defaults to time. But we'll do it anyway.
+  myRandGen.seed(rngSeed());
+}
+
+uInt32 OSystem::rngSeed() const {
   if (mySettings->getInt("random_seed") == 0) {
-    myRandGen.seed((uInt32)time(NULL));
+    return (uInt32)time(NULL);
   } else {
     int seed = mySettings->getInt("random_seed");
     assert(seed >= 0);
-    myRandGen.seed((uInt32)seed);
+    return (uInt32)seed;
   }
 }
 
@@ -183,25 +196,37 @@ bool OSystem::loadState(Deserializer& in) {
     return myRandGen.loadState(in);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 OSystem::memoryUsage() const
+{
+  uInt32 usage = sizeof(*this) + sizeof(Event) +
+      m_colour_palette.memoryUsage();
+
+  // The built-in properties are shared; only those loaded from a file count
+  if(myPropSet != NULL)
+    usage += sizeof(PropertiesSet) + myPropSet->size() * sizeof(Properties);
+
+  return usage;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void OSystem::setConfigPaths()
 {
   myGameListCacheFile = myBaseDir + BSPF_PATH_SEPARATOR + "stella.cache";
 
+  // ALE: the default paths aren't written back to the settings, which then
+  // keep sharing the default settings table
   myCheatFile = mySettings->getString("cheatfile");
   if(myCheatFile == "")
     myCheatFile = myBaseDir + BSPF_PATH_SEPARATOR + "stella.cht";
-  mySettings->setString("cheatfile", myCheatFile);
 
   myPaletteFile = mySettings->getString("palettefile");
   if(myPaletteFile == "")
     myPaletteFile = myBaseDir + BSPF_PATH_SEPARATOR + "stella.pal";
-  mySettings->setString("palettefile", myPaletteFile);
 
   myPropertiesFile = mySettings->getString("propsfile");
   if(myPropertiesFile == "")
     myPropertiesFile = myBaseDir + BSPF_PATH_SEPARATOR + "stella.pro";
-  mySettings->setString("propsfile", myPropertiesFile);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -218,9 +243,9 @@ ALE */
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void OSystem::setBaseDir(const string& basedir)
 {
+  // ALE: nothing is ever written to the base directory, so it is neither
+  // probed for nor created
   myBaseDir = basedir;
-  if(!FilesystemNode::dirExists(myBaseDir))
-    FilesystemNode::makeDir(myBaseDir);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -341,7 +366,9 @@ void OSystem::createSound()
       mySound = new SoundNull(this);
   }
 #else
-  mySettings->setBool("sound", false);
+  // Writing the setting unshares the settings table, so only do it if needed
+  if (mySettings->getBool("sound"))
+    mySettings->setBool("sound", false);
   mySound = new SoundNull(this);
 #endif
 }
@@ -353,77 +380,119 @@ bool OSystem::createConsole(const string& romfile)
   // Do a little error checking; it shouldn't be necessary
   if(myConsole) deleteConsole();
 
-  bool retval = false; 
-
   // If a blank ROM has been given, we reload the current one (assuming one exists)
-  if(romfile == "")
+  string file = romfile;
+  if(file == "")
   {
     if(myRomFile == "")
     {
       ale::Logger::Error << "ERROR: Rom file not specified ..." << endl;
       return false;
     }
+    file = myRomFile;
   }
-  else
-    myRomFile = romfile;
 
   // Open the cartridge image and read it in
-  uInt8* image;
-  int size = -1;
-  string md5;
-  if(openROM(myRomFile, md5, &image, &size))
+  shared_ptr<const RomImage> image;
+  if(!openROM(file, image))
   {
-    // Get all required info for creating a valid console
-    Cartridge* cart = (Cartridge*) NULL;
-    Properties props;
-    if(queryConsoleInfo(image, size, md5, &cart, props))
-    {
-      // Create an instance of the 2600 game console
-      myConsole = new Console(this, cart, props);
-      m_colour_palette.loadUserPalette(paletteFile());
+    myRomFile = file;
+    ale::Logger::Error << "ERROR: Couldn't open " << myRomFile << " ..." << endl;
+    return false;
+  }
 
-    #ifdef CHEATCODE_SUPPORT
-      myCheatManager->loadCheats(md5);
-    #endif
-      //ALE  myEventHandler->reset(EventHandler::S_EMULATE);
-      //ALE  createFrameBuffer(false);  // Takes care of initializeVideo()
-      //ALE  myConsole->initializeAudio();
-    #ifdef DEBUGGER_SUPPORT
-      myDebugger->setConsole(myConsole);
-      myDebugger->initialize();
-    #endif
+  if(!createConsole(image, file))
+    return false;
 
-      if(mySettings->getBool("showinfo"))
-        cerr << "Game console created:" << endl
-             << "  ROM file:  " << myRomFile << endl
-             << myConsole->about() << endl;
-      else
-        ale::Logger::Info << "Game console created:" << endl
-             << "  ROM file:  " << myRomFile << endl
-             << myConsole->about() << endl;
+  m_colour_palette.loadUserPalette(paletteFile());
+  return true;
+}
 
-      // Update the timing info for a new console run
-      resetLoopTiming();
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool OSystem::createConsole(const shared_ptr<const RomImage>& image,
+                            const string& romfile)
+{
+  if(myConsole) deleteConsole();
 
-      //ALE  myFrameBuffer->setCursorState();
-      retval = true;
-    }
-    else
-    {
-      ale::Logger::Error << "ERROR: Couldn't create console for " << myRomFile << " ..." << endl;
-      retval = false;
-    }
+  myRomFile = romfile;
+
+  // Get all required info for creating a valid console
+  Cartridge* cart = (Cartridge*) NULL;
+  Properties props;
+  if(!queryConsoleInfo(image, &cart, props))
+  {
+    ale::Logger::Error << "ERROR: Couldn't create console for " << myRomFile << " ..." << endl;
+    return false;
   }
+
+  // Create an instance of the 2600 game console
+  myConsole = new Console(this, cart, props);
+
+#ifdef CHEATCODE_SUPPORT
+  myCheatManager->loadCheats(image->md5());
+#endif
+  //ALE  myEventHandler->reset(EventHandler::S_EMULATE);
+  //ALE  createFrameBuffer(false);  // Takes care of initializeVideo()
+  //ALE  myConsole->initializeAudio();
+#ifdef DEBUGGER_SUPPORT
+  myDebugger->setConsole(myConsole);
+  myDebugger->initialize();
+#endif
+
+  if(mySettings->getBool("showinfo"))
+    cerr << "Game console created:" << endl
+         << "  ROM file:  " << myRomFile << endl
+         << myConsole->about() << endl;
   else
-  {
-    ale::Logger::Error << "ERROR: Couldn't open " << myRomFile << " ..." << endl;
-    retval = false;
+    ale::Logger::Info << "Game console created:" << endl
+         << "  ROM file:  " << myRomFile << endl
+         << myConsole->about() << endl;
+
+  // Update the timing info for a new console run
+  resetLoopTiming();
+
+  //ALE  myFrameBuffer->setCursorState();
+  if (mySettings->getBool("display_screen", true)) {
+#ifndef __USE_SDL
+    ale::Logger::Error << "Screen display requires directive __USE_SDL to be defined."
+                            << " Please recompile with flag '-D__USE_SDL'."
+                            << " See makefile for more information."
+                            << std::endl;
+    exit(1);
+#endif
+    p_display_screen = new DisplayScreen(&myConsole->mediaSource(),
+                                         mySound, m_colour_palette); 
   }
 
-  // Free the image since we don't need it any longer
-  if(size != -1) {
-    delete[] image;
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool OSystem::createConsole(const Console& console)
+{
+  if(myConsole) deleteConsole();
+
+  myRomFile = console.osystem().romFile();
+
+  // The display format was detected by the given console already
+  Properties props = console.properties();
+  props.set(Display_Format, console.getFormat());
+
+  // The cartridge RAM is overwritten when the state is copied over
+  Random cartRandGen;
+  cartRandGen.seed(rngSeed());
+  Cartridge* cart = Cartridge::create(console.cartridge().romImage(), props,
+                                      *mySettings, cartRandGen);
+  if(!cart)
+  {
+    ale::Logger::Error << "ERROR: Couldn't create console for " << myRomFile << " ..." << endl;
+    return false;
   }
+  myConsole = new Console(this, cart, props);
+
+  // Update the timing info for a new console run
+  resetLoopTiming();
+
   if (mySettings->getBool("display_screen", true)) {
 #ifndef __USE_SDL
     ale::Logger::Error << "Screen display requires directive __USE_SDL to be defined."
@@ -436,7 +505,7 @@ bool OSystem::createConsole(const string& romfile)
                                          mySound, m_colour_palette); 
   }
 
-  return retval;
+  return true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -483,42 +552,11 @@ void OSystem::createLauncher()
 ALE */
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool OSystem::openROM(const string& rom, string& md5, uInt8** image, int* size)
+bool OSystem::openROM(const string& rom, shared_ptr<const RomImage>& image)
 {
-  // Assume the file is either gzip'ed or not compressed at all
-  gzFile f = gzopen(rom.c_str(), "rb");
-  if(!f)
-    return false;
-
-  *image = new uInt8[MAX_ROM_SIZE];
-  *size = gzread(f, *image, MAX_ROM_SIZE);
-  gzclose(f);
-
-  // If we get to this point, we know we have a valid file to open
-  // Now we make sure that the file has a valid properties entry
-  md5 = MD5(*image, *size);
-
-  // Some games may not have a name, since there may not
-  // be an entry in stella.pro.  In that case, we use the rom name
-  // and reinsert the properties object
-  Properties props;
-  myPropSet->getMD5(md5, props);
-
-  string name = props.get(Cartridge_Name);
-  if(name == "Untitled")
-  {
-    // Get the filename from the rom pathname
-    string::size_type pos = rom.find_last_of(BSPF_PATH_SEPARATOR);
-    if(pos+1 != string::npos)
-    {
-      name = rom.substr(pos+1);
-      props.set(Cartridge_MD5, md5);
-      props.set(Cartridge_Name, name);
-      myPropSet->insert(props, false);
-    }
-  }
-
-  return true;
+  // Open ROMs are shared, and only read again if the file has changed
+  image = RomImage::open(rom, this);
+  return image.get() != 0;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -527,15 +565,13 @@ string OSystem::getROMInfo(const string& romfile)
   ostringstream buf;
 
   // Open the cartridge image and read it in
-  uInt8* image;
-  int size = -1;
-  string md5;
-  if(openROM(romfile, md5, &image, &size))
+  shared_ptr<const RomImage> image;
+  if(openROM(romfile, image))
   {
     // Get all required info for creating a temporary console
     Cartridge* cart = (Cartridge*) NULL;
     Properties props;
-    if(queryConsoleInfo(image, size, md5, &cart, props))
+    if(queryConsoleInfo(image, &cart, props))
     {
       Console* console = new Console(this, cart, props);
       if(console)
@@ -548,21 +584,16 @@ string OSystem::getROMInfo(const string& romfile)
     else
       buf << "ERROR: Couldn't open " << romfile << " ..." << endl;
   }
-  // Free the image and console since we don't need it any longer
-  if(size != -1)
-    delete[] image;
-
   return buf.str();
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-bool OSystem::queryConsoleInfo(const uInt8* image, uInt32 size,
-                               const string& md5,
+bool OSystem::queryConsoleInfo(const shared_ptr<const RomImage>& image,
                                Cartridge** cart, Properties& props)
 {
   // Get a valid set of properties, including any entered on the commandline
   string s;
-  myPropSet->getMD5(md5, props);
+  props = image->properties();
   
     s = mySettings->getString("type");
     if(s != "") props.set(Cartridge_Type, s);
@@ -600,7 +631,12 @@ bool OSystem::queryConsoleInfo(const uInt8* image, uInt32 size,
     s = mySettings->getString("hmove");
     if(s != "") props.set(Emulation_HmoveBlanks, s);
 
-  *cart = Cartridge::create(image, size, props, *mySettings);
+  // The cartridge RAM gets its own generator, seeded like ours: it is
+  // reproducible for a given random_seed, and what the console draws from
+  // our generator doesn't depend on the cartridge type
+  Random cartRandGen;
+  cartRandGen.seed(rngSeed());
+  *cart = Cartridge::create(image, props, *mySettings, cartRandGen);
   if(!*cart)
     return false;
 
@@ -20,6 +20,7 @@
 #define OSYSTEM_HXX
 
 class PropertiesSet;
+class RomImage;
 class GameController;
 class Menu;
 class CommandMenu;
@@ -27,6 +28,7 @@ class Launcher;
 class Debugger;
 class CheatManager;
 class VideoDialog;
+#include <memory>
 #include "../common/Array.hxx"
 //ALE  #include "EventHandler.hxx"
 //ALE  #include "FrameBuffer.hxx"
@@ -41,6 +43,7 @@ class VideoDialog;
 #include "../common/ColourPalette.hpp"
 #include "../common/ScreenExporter.hpp"
 #include "../common/Log.hpp"
+#include "../common/Profiler.hpp"
 
 struct Resolution {
   uInt32 width;
@@ -122,11 +125,12 @@ class OSystem
     inline Settings& settings() const { return *mySettings; }
 
     /**
-      Get the set of game properties for the system
+      Get the set of game properties for the system.  The properties
+      file is only read when the set is first needed.
 
       @return The properties set object
     */
-    inline PropertiesSet& propSet() const { return *myPropSet; }
+    PropertiesSet& propSet();
 
     /**
       Get the console of the system.
@@ -297,6 +301,17 @@ class OSystem
     */
     bool createConsole(const std::string& romfile = "");
 
+    /**
+      Creates a new game console from the given ROM image, without reading
+      any file.
+
+      @param image    The image of the ROM to use
+      @param romfile  The pathname or name the ROM goes by
+      @return  True on successful creation, otherwise false
+    */
+    bool createConsole(const std::shared_ptr<const RomImage>& image,
+                       const std::string& romfile);
+
     /**
       Deletes the currently defined console, if it exists.
       Also prints some statistics (fps, total frames, etc).
@@ -325,16 +340,24 @@ class OSystem
     const std::string& features() const { return myFeatures; }
 
     /**
-      Open the given ROM and return an array containing its contents.
+      Creates a new game console that plays the same cartridge as the
+      given one, of another system, in the display format it uses.  No
+      file is read and no properties are looked up; the state of the
+      console is up to the caller to copy.
+
+      @param console  The console to copy
+      @return  True on successful creation, otherwise false
+    */
+    bool createConsole(const Console& console);
+
+    /**
+      Open the given ROM and get the image of its contents.
 
       @param rom    The absolute pathname of the ROM file
-      @param md5    The md5 calculated from the ROM file
-      @param image  A pointer to store the ROM data
-                    Note, the calling method is responsible for deleting this
-      @param size   The amount of data read into the image array
+      @param image  Set to the image of the ROM
       @return  False on any errors, else true
     */
-    bool openROM(const std::string& rom, std::string& md5, uInt8** image, int* size);
+    bool openROM(const std::string& rom, std::shared_ptr<const RomImage>& image);
 
     /**
       Issue a quit event to the OSystem.
@@ -348,6 +371,17 @@ class OSystem
     */
     Random& rng() { return myRandGen; }
 
+    /**
+      Returns the timing counters of this emulator.
+    */
+    Profiler& profiler() { return myProfiler; }
+
+    /**
+      Returns the memory used by this object, its event and its palette,
+      but not by its settings, console or sound.
+    */
+    uInt32 memoryUsage() const;
+
     /**
       Resets the seed for our random number generator.
     */
@@ -458,6 +492,9 @@ class OSystem
     
     // Random number generator shared across the emulator's components
     Random myRandGen; 
+
+    // Where this emulator's time goes, if built with USE_PROFILING
+    Profiler myProfiler;
     
     // Pointer to the Menu object
     //ALE  Menu* myMenu;
@@ -560,9 +597,15 @@ class OSystem
 
       @return Success or failure for a valid console
     */
-    bool queryConsoleInfo(const uInt8* image, uInt32 size, const std::string& md5,
+    bool queryConsoleInfo(const std::shared_ptr<const RomImage>& image,
                           Cartridge** cart, Properties& props);
 
+    /**
+      Returns the seed for our random number generator: random_seed, or the
+      time if it is 0.
+    */
+    uInt32 rngSeed() const;
+
     /**
       Initializes the timing so that the mainloop is reset to its
       initial values.
@@ -39,6 +39,14 @@ PropertiesSet::PropertiesSet(OSystem* osystem)
     cerr << "User game properties: \'" << props << "\'\n";
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+PropertiesSet::PropertiesSet()
+  : myOSystem(NULL),
+    myRoot(NULL),
+    mySize(0)
+{
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 PropertiesSet::~PropertiesSet()
 {
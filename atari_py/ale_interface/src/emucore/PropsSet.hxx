@@ -45,6 +45,12 @@ class PropertiesSet
     */
     PropertiesSet(OSystem* osystem);
 
+    /**
+      Create a properties set of the built-in properties only, without
+      reading any file.
+    */
+    PropertiesSet();
+
     /**
       Destructor
     */
@@ -25,9 +25,6 @@
 // #include <random>
 #include "TinyMT/tinymt32.h"
 
-// A static Random object for compatibility purposes. Don't use this.
-Random Random::s_random;
-
 // Implementation of Random's random number generator wrapper. 
 class Random::Impl {
   
@@ -116,10 +113,6 @@ double Random::nextDouble()
   return m_pimpl->nextDouble();
 }
 
-Random& Random::getInstance() {
-  return s_random;
-}
-
 bool Random::saveState(Serializer& ser) {
 
   // Serialize the TinyMT state
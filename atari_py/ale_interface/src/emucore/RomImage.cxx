@@ -0,0 +1,231 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <zlib.h>
+
+#include "Cart.hxx"
+#include "MD5.hxx"
+#include "OSystem.hxx"
+#include "PropsSet.hxx"
+#include "RomImage.hxx"
+using namespace std;
+
+#define MAX_ROM_SIZE  512 * 1024
+
+namespace {
+  // What a file was when its image was read: a file rewritten in place
+  // changes its mtime, and one renamed over it its inode
+  struct FileStamp
+  {
+    Int64 size;
+    Int64 mtime;
+    Int64 mtimeNanoseconds;
+    uInt64 device;
+    uInt64 inode;
+
+    bool operator == (const FileStamp& other) const
+    {
+      return size == other.size && mtime == other.mtime &&
+             mtimeNanoseconds == other.mtimeNanoseconds &&
+             device == other.device && inode == other.inode;
+    }
+  };
+
+  bool stampFile(const string& filename, FileStamp& stamp)
+  {
+    struct stat st;
+    if(stat(filename.c_str(), &st) != 0)
+      return false;
+
+    stamp.size = st.st_size;
+    stamp.mtime = st.st_mtime;
+#if defined(__APPLE__)
+    stamp.mtimeNanoseconds = st.st_mtimespec.tv_nsec;
+#elif defined(BSPF_WIN32) || defined(_WIN32)
+    stamp.mtimeNanoseconds = 0;
+#else
+    stamp.mtimeNanoseconds = st.st_mtim.tv_nsec;
+#endif
+    stamp.device = st.st_dev;
+    stamp.inode = st.st_ino;
+    return true;
+  }
+
+  // An image in use, and what its file was when it was read
+  struct CachedImage
+  {
+    weak_ptr<const RomImage> image;
+    FileStamp stamp;
+  };
+
+  // The images in use, by what they were opened from
+  typedef map<string, weak_ptr<const RomImage> > ImageCache;
+  typedef map<string, CachedImage> FileImageCache;
+
+  bool expired(const weak_ptr<const RomImage>& image) { return image.expired(); }
+  bool expired(const CachedImage& cached) { return cached.image.expired(); }
+
+  // Forget the images that no console uses anymore
+  template<class Cache>
+  void eraseUnused(Cache& cache)
+  {
+    for(typename Cache::iterator it = cache.begin(); it != cache.end(); )
+    {
+      if(expired(it->second))
+        cache.erase(it++);
+      else
+        ++it;
+    }
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const RomImage> RomImage::open(const string& filename,
+                                          OSystem* osystem)
+{
+  static mutex cacheMutex;
+  static FileImageCache cache;
+
+  FileStamp stamp;
+  if(!stampFile(filename, stamp))
+    return shared_ptr<const RomImage>();
+
+  // The properties of a ROM also depend on the user's properties file
+  const string key = filename + '\n' + osystem->propertiesFile();
+
+  {
+    lock_guard<mutex> lock(cacheMutex);
+    eraseUnused(cache);
+    FileImageCache::const_iterator it = cache.find(key);
+    if(it != cache.end() && it->second.stamp == stamp)
+    {
+      shared_ptr<const RomImage> image = it->second.image.lock();
+      if(image)
+        return image;
+    }
+  }
+
+  // Assume the file is either gzip'ed or not compressed at all
+  gzFile f = gzopen(filename.c_str(), "rb");
+  if(!f)
+    return shared_ptr<const RomImage>();
+
+  // Only the pages the ROM is read into are ever touched
+  unique_ptr<uInt8[]> contents(new uInt8[MAX_ROM_SIZE]);
+  int size = gzread(f, contents.get(), MAX_ROM_SIZE);
+  gzclose(f);
+  if(size < 0)
+    return shared_ptr<const RomImage>();
+
+  // Some games may not have a name, since there may not be an entry in
+  // stella.pro.  In that case, we use the rom name
+  string name = filename;
+  string::size_type pos = filename.find_last_of(BSPF_PATH_SEPARATOR);
+  if(pos != string::npos)
+    name = filename.substr(pos + 1);
+
+  shared_ptr<const RomImage> image(
+      new RomImage(contents.get(), size, name, osystem->propSet()));
+
+  lock_guard<mutex> lock(cacheMutex);
+  CachedImage& cached = cache[key];
+  cached.image = image;
+  cached.stamp = stamp;
+
+  return image;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const RomImage> RomImage::open(const uInt8* image, uInt32 size,
+                                          const string& name)
+{
+  static mutex cacheMutex;
+  static ImageCache cache;
+  static const PropertiesSet builtInProperties;
+
+  if(size > MAX_ROM_SIZE)
+    return shared_ptr<const RomImage>();
+
+  // The name only matters to ROMs the built-in properties don't know
+  const string key = MD5(image, size) + '\n' + name;
+
+  lock_guard<mutex> lock(cacheMutex);
+  eraseUnused(cache);
+  weak_ptr<const RomImage>& cached = cache[key];
+  shared_ptr<const RomImage> rom = cached.lock();
+  if(!rom)
+  {
+    rom.reset(new RomImage(image, size, name, builtInProperties));
+    cached = rom;
+  }
+
+  return rom;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomImage::RomImage(const uInt8* image, uInt32 size, const string& name,
+                   const PropertiesSet& propset)
+  : myImage(image, image + size),
+    mySize(size)
+{
+  myMD5 = MD5(image, size);
+
+  propset.getMD5(myMD5, myProperties);
+  if(myProperties.get(Cartridge_Name) == "Untitled")
+  {
+    myProperties.set(Cartridge_MD5, myMD5);
+    myProperties.set(Cartridge_Name, name);
+  }
+
+  myDetectedType = Cartridge::autodetectType(image, size);
+
+  // Pad the image to what the cartridge of its type reads
+  string type = myProperties.get(Cartridge_Type);
+  if(type == "AUTO-DETECT")
+    type = myDetectedType;
+  myImage.resize(Cartridge::imageSize(type, size), 0);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+RomImage::RomImage(const RomImage& rom, uInt32 imageSize)
+  : myImage(rom.myImage),
+    mySize(rom.mySize),
+    myMD5(rom.myMD5),
+    myProperties(rom.myProperties),
+    myDetectedType(rom.myDetectedType)
+{
+  if(myImage.size() < imageSize)
+    myImage.resize(imageSize, 0);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+shared_ptr<const RomImage> RomImage::padded(uInt32 imageSize) const
+{
+  return shared_ptr<const RomImage>(new RomImage(*this, imageSize));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 RomImage::memoryUsage() const
+{
+  return sizeof(*this) + myImage.capacity() + myMD5.capacity() +
+         myDetectedType.capacity();
+}
@@ -0,0 +1,152 @@
+//============================================================================
+//
+//   SSSS    tt          lll  lll
+//  SS  SS   tt           ll   ll
+//  SS     tttttt  eeee   ll   ll   aaaa
+//   SSSS    tt   ee  ee  ll   ll      aa
+//      SS   tt   eeeeee  ll   ll   aaaaa  --  "An Atari 2600 VCS Emulator"
+//  SS  SS   tt   ee      ll   ll  aa  aa
+//   SSSS     ttt  eeeee llll llll  aaaaa
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#ifndef ROMIMAGE_HXX
+#define ROMIMAGE_HXX
+
+class OSystem;
+class PropertiesSet;
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "m6502/src/bspf/src/bspf.hxx"
+#include "Props.hxx"
+
+/**
+  The contents of a ROM and everything that is worked out from them
+  alone: the md5, the properties and the auto-detected bankswitching
+  type.
+
+  Images are read-only and shared.  The cartridges of the ROMs with
+  read-only memory reference the image instead of copying it, and an
+  image of a file stays cached for as long as any console uses it, so
+  opening a ROM that is already open and whose file hasn't changed
+  since reads and looks up nothing.
+*/
+class RomImage
+{
+  public:
+    /**
+      Get the image of the given ROM file, which may be gzip'ed.  The image
+      in use is shared if the file still has the same size, mtime and
+      inode.
+
+      @param filename The pathname of the ROM file
+      @param osystem  The system whose properties set the ROM is looked up in
+      @return The image, or the null pointer if the file can't be read
+    */
+    static std::shared_ptr<const RomImage> open(const std::string& filename,
+                                                OSystem* osystem);
+
+    /**
+      Get the image of the given ROM contents, whose properties come from
+      the built-in properties only.  Nothing is read, and an image of the
+      same contents that is in use is shared.
+
+      @param image The contents of the ROM
+      @param size  The size of the ROM
+      @param name  The name of the ROM if the built-in properties have none
+      @return The image, or the null pointer if the ROM is too large
+    */
+    static std::shared_ptr<const RomImage> open(const uInt8* image,
+                                                uInt32 size,
+                                                const std::string& name);
+
+    /**
+      Create an image of the given ROM contents.
+
+      @param image   The contents of the ROM
+      @param size    The size of the ROM
+      @param name    The name of the ROM if the properties set has none
+      @param propset The properties set to look the ROM up in
+    */
+    RomImage(const uInt8* image, uInt32 size, const std::string& name,
+             const PropertiesSet& propset);
+
+    /**
+      Get a copy of this image that can be read up to the given size, for
+      a cartridge type that reads more than the ROM's own type does.
+
+      @param imageSize The number of bytes that can be read
+      @return The copy, which isn't shared
+    */
+    std::shared_ptr<const RomImage> padded(uInt32 imageSize) const;
+
+  public:
+    /**
+      Get the contents of the ROM.  As much as the cartridge of the ROM's
+      type reads can be read, and anything past the end of the ROM reads
+      as zero.
+    */
+    const uInt8* image() const { return &myImage[0]; }
+
+    /**
+      Get the number of bytes of the contents that can be read
+    */
+    uInt32 imageSize() const { return myImage.size(); }
+
+    /**
+      Get the size of the ROM, as read from the file
+    */
+    uInt32 size() const { return mySize; }
+
+    /**
+      Get the md5 of the ROM
+    */
+    const std::string& md5() const { return myMD5; }
+
+    /**
+      Get the properties of the ROM from the properties set
+    */
+    const Properties& properties() const { return myProperties; }
+
+    /**
+      Get the bankswitching type the contents look like
+    */
+    const std::string& detectedType() const { return myDetectedType; }
+
+    /**
+      Get the memory used by the image
+
+      @return The number of bytes used
+    */
+    uInt32 memoryUsage() const;
+
+  private:
+    // Copy the given image, padded to the given size
+    RomImage(const RomImage& rom, uInt32 imageSize);
+
+    // The contents of the ROM, padded with zeros
+    std::vector<uInt8> myImage;
+
+    // The size of the ROM
+    uInt32 mySize;
+
+    std::string myMD5;
+    Properties myProperties;
+    std::string myDetectedType;
+
+    // Copy constructor isn't supported by this class so make it private
+    RomImage(const RomImage&);
+
+    // Assignment operator isn't supported by this class so make it private
+    RomImage& operator = (const RomImage&);
+};
+
+#endif
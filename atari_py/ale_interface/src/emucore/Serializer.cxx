@@ -17,55 +17,101 @@
 //============================================================================
 
 #include "Serializer.hxx"
+#include <cstring>
 using namespace std;
 
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Serializer::Serializer(void) {
-    myStream.clear();
-    
+Serializer::Serializer(void)
+  : myBuffer(myOwnBuffer),
+    myCompact(false)
+{
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Serializer::~Serializer(void)
+Serializer::Serializer(string& buffer, bool compact)
+  : myBuffer(buffer),
+    myCompact(compact)
 {
-    close();
+  myBuffer.clear();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Serializer::~Serializer(void)
+{
+  close();
+}
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::close(void)
 {
-    myStream.clear();
 }
 
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putInt(int value)
 {
-    unsigned char buf[4];
-    for(int i = 0; i < 4; ++i)
-        buf[i] = (value >> (i<<3)) & 0xff;
-    
-    myStream.write((char*)buf, 4);
-    if(myStream.bad())
-        throw "Serializer: file write failed";
+  if(myCompact)
+  {
+    // Seven bits at a time, with the sign in the lowest bit
+    uInt32 bits = ((uInt32)value << 1) ^ (uInt32)(value >> 31);
+    while(bits >= 0x80)
+    {
+      myBuffer.push_back((char)(bits | 0x80));
+      bits >>= 7;
+    }
+    myBuffer.push_back((char)bits);
+    return;
+  }
+
+  char buf[4];
+  for(int i = 0; i < 4; ++i)
+    buf[i] = (value >> (i<<3)) & 0xff;
+
+  myBuffer.append(buf, 4);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putString(const string& str)
 {
-    int len = str.length();
-    putInt(len);
-    myStream.write(str.data(), (streamsize)len);
-    
-    if(myStream.bad())
-        throw "Serializer: file write failed";
+  putInt(str.length());
+  myBuffer.append(str);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Serializer::putBool(bool b)
 {
+  if(myCompact)
+    myBuffer.push_back(b ? 1 : 0);
+  else
     putInt(b ? TruePattern: FalsePattern);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::putByte(uInt8 value)
+{
+  if(myCompact)
+    myBuffer.push_back((char)value);
+  else
+    putInt(value);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::putBytes(const uInt8* values, uInt32 count)
+{
+  if(myCompact)
+  {
+    myBuffer.append((const char*)values, count);
+  }
+  else
+  {
+    // One int per byte; grow the buffer once instead of per value
+    size_t offset = myBuffer.size();
+    myBuffer.resize(offset + 4 * (size_t)count);
+    char* out = &myBuffer[offset];
+    for(uInt32 i = 0; i < count; ++i, out += 4)
+    {
+      out[0] = values[i];
+      out[1] = out[2] = out[3] = 0;
+    }
+  }
+}
@@ -19,7 +19,7 @@
 #ifndef SERIALIZER_HXX
 #define SERIALIZER_HXX
 
-#include <sstream>
+#include <string>
 #include "m6502/src/bspf/src/bspf.hxx"
 
 /**
@@ -36,16 +36,31 @@
   
   Revised for ALE on Sep 20, 2009
   The new version uses a stringstream (not a file stream)
+
+  Revised for ALE again: data is appended straight to a string buffer,
+  optionally one provided by the caller.  In compact mode, bytes and
+  booleans take a single byte, byte arrays are copied as they are, and
+  ints and string lengths are written as zigzag varints, so that the
+  small ones take a single byte too.
 */
 class Serializer
 {
   public:
     /**
-      Creates a new Serializer device.
-
+      Creates a new Serializer device, writing the portable format
+      into its own buffer.
     */
     Serializer(void);
 
+    /**
+      Creates a new Serializer device writing into the given buffer.
+      The buffer is cleared first, but keeps its capacity.
+
+      @param buffer  The string to append the serialized data to
+      @param compact Whether to use the compact format
+    */
+    Serializer(std::string& buffer, bool compact = false);
+
     /**
       Destructor
     */
@@ -80,19 +95,43 @@ class Serializer
     */
     void putBool(bool b);
 
-    // Accessor for myStream
-    // TODO: don't copy the whole streams. 
-    std::string get_str(void) const {
-        return myStream.str();
+    /**
+      Writes a byte value to the current output stream.
+
+      @param value The byte value to write to the output stream.
+    */
+    void putByte(uInt8 value);
+
+    /**
+      Writes an array of bytes to the current output stream.
+
+      @param values The bytes to write to the output stream.
+      @param count  The number of bytes to write
+    */
+    void putBytes(const uInt8* values, uInt32 count);
+
+    // Accessor for the serialized data
+    const std::string& get_str(void) const {
+        return myBuffer;
     }
   private:
-    // The stream to send the serialized data to.
-    std::stringstream myStream;
+    // Storage used when the caller did not provide a buffer
+    std::string myOwnBuffer;
+
+    // The buffer to send the serialized data to.
+    std::string& myBuffer;
+
+    // Whether the data is written in the compact format
+    bool myCompact;
 
     enum {
       TruePattern  = 0xfab1fab2,
       FalsePattern = 0xbad1bad2
     };
+
+    // Disallow copying
+    Serializer(const Serializer&);
+    Serializer& operator=(const Serializer&);
 };
 
 #endif
@@ -29,10 +29,33 @@ using namespace std;
 #include "Settings.hxx"
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-Settings::Settings(OSystem* osystem) : myOSystem(osystem) {
+Settings::Settings(OSystem* osystem)
+  : myOSystem(osystem),
+    myFrameSkip(1),
+    myRepeatActionProbability(0.25),
+    myColorAveraging(false),
+    myMaxNumFramesPerEpisode(0),
+    myIsValid(false) {
     // Add this settings object to the OSystem
     myOSystem->attach(this);
 
+    // Start from the defaults, sharing their tables until a setting changes
+    copy(defaults());
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+Settings::Settings()
+  : myOSystem(NULL),
+    myInternalSettings(new SettingsTable),
+    myExternalSettings(new SettingsTable),
+    myFrameSkip(1),
+    myRepeatActionProbability(0.25),
+    myColorAveraging(false),
+    myMaxNumFramesPerEpisode(0),
+    myIsValid(false) {
+    myInternalSettings->positions.reset(new PositionMap);
+    myExternalSettings->positions.reset(new PositionMap);
+
     // Add options that are common to all versions of Stella
     setInternal("video", "soft");
 
@@ -97,11 +120,31 @@ Settings::Settings(OSystem* osystem) : myOSystem(osystem) {
     setDefaultSettings();
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const Settings& Settings::defaults()
+{
+  static const Settings ourDefaults;
+  return ourDefaults;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 Settings::~Settings()
 {
-  myInternalSettings.clear();
-  myExternalSettings.clear();
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::copy(const Settings& settings)
+{
+  // The tables are copied when either settings object changes them
+  myUserSettings = settings.myUserSettings;
+  myInternalSettings = settings.myInternalSettings;
+  myExternalSettings = settings.myExternalSettings;
+
+  myFrameSkip = settings.myFrameSkip;
+  myRepeatActionProbability = settings.myRepeatActionProbability;
+  myColorAveraging = settings.myColorAveraging;
+  myMaxNumFramesPerEpisode = settings.myMaxNumFramesPerEpisode;
+  myIsValid = settings.myIsValid;
 }
 
 void Settings::loadConfig(const char* config_file){
@@ -188,7 +231,8 @@ string Settings::loadCommandLine(int argc, char** argv)
 
       // Settings read from the commandline must not be saved to 
       // the rc-file, unless they were previously set
-      if(int idx = getInternalPos(key) != -1)
+      int idx = getInternalPos(key);
+      if(idx != -1)
         setInternal(key, value, idx);   // don't set initialValue here
       else
         setExternal(key, value);
@@ -203,6 +247,9 @@ string Settings::loadCommandLine(int argc, char** argv)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::validate()
 {
+  if(myIsValid)
+    return;
+
   string s;
   int i;
 
@@ -257,6 +304,8 @@ void Settings::validate()
   s = getString("palette");
   if(s != "standard" && s != "z26" && s != "user")
     setInternal("palette", "standard");
+
+  myIsValid = true;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -306,6 +355,29 @@ void Settings::usage() {
        "   -repeat_action_probability (default: 0.25)\n"
        "     Stochasticity in the environment. It is the probability the previous "
                 "action will repeated without executing the new one.\n"
+       "   -reset_cache [true|false] (default: false)\n"
+       "     Restores a snapshot of an earlier reset instead of emulating the reset "
+                "frames again. Restored resets are identical to emulated ones, random "
+                "number generator included.\n"
+       "   -compact_state [true|false] (default: false)\n"
+       "     Clones states in a compact format that is faster to save and restore. "
+                "Restoring accepts either format.\n"
+       "   -render_skip [true|false] (default: false)\n"
+       "     Skips drawing the frames of a frame skip that don't make up the final "
+                "screen\n"
+       "   -compact_memory [true|false] (default: false)\n"
+       "     Saves the copy of the screen, 33 KB of the 150 KB of an environment, by "
+                "showing the emulator's frame buffer, which is only valid until the next "
+                "act(). Has no effect with color_averaging.\n"
+       "   -preprocess_observations [true|false] (default: false)\n"
+       "     Maintains a stack of downsampled grayscale frames, max-pooled over the "
+                "last two frames of each act(), as used by DQN.\n"
+       "   -observation_width w, -observation_height h (default: 84, 84)\n"
+       "     Size of the preprocessed frames\n"
+       "   -observation_stack n (default: 4)\n"
+       "     Number of preprocessed frames in an observation\n"
+       "   -observation_max_pool [true|false] (default: true)\n"
+       "     Takes the maximum of the last two frames rather than the last frame\n"
        "\n"
        " FIFO Controller arguments:\n"
        "   -run_length_encoding [true|false] (default: true)\n"
@@ -334,9 +406,10 @@ void Settings::saveConfig()
   // Do a quick scan of the internal settings to see if any have
   // changed.  If not, we don't need to save them at all.
   bool settingsChanged = false;
-  for(unsigned int i = 0; i < myInternalSettings.size(); ++i)
+  const SettingsArray& settings = myInternalSettings->settings;
+  for(unsigned int i = 0; i < settings.size(); ++i)
   {
-    if(myInternalSettings[i].value != myInternalSettings[i].initialValue)
+    if(settings[i].value != settings[i].initialValue)
     {
       settingsChanged = true;
       break;
@@ -369,10 +442,10 @@ void Settings::saveConfig()
       << ";" << endl;
 
   // Write out each of the key and value pairs
-  for(unsigned int i = 0; i < myInternalSettings.size(); ++i)
+  for(unsigned int i = 0; i < settings.size(); ++i)
   {
-    out << myInternalSettings[i].key << " = " <<
-           myInternalSettings[i].value << endl;
+    out << settings[i].key << " = " <<
+           settings[i].value << endl;
   }
 
   out.close();
@@ -381,15 +454,15 @@ void Settings::saveConfig()
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setInt(const string& key, const int value)
 {
-  std::ostringstream stream;
-  stream << value;
+  const string str = to_string(value);
 
-  if(int idx = getInternalPos(key) != -1){
-    setInternal(key, stream.str(), idx);
+  int idx = getInternalPos(key);
+  if(idx != -1){
+    setInternal(key, str, idx);
   }
   else{
-    verifyVariableExistence(intSettings, key);
-    setExternal(key, stream.str());
+    verifyVariableExistence(myUserSettings->intSettings, key);
+    setExternal(key, str);
   }
 }
 
@@ -399,11 +472,12 @@ void Settings::setFloat(const string& key, const float value)
   std::ostringstream stream;
   stream << value;
 
-  if(int idx = getInternalPos(key) != -1){
+  int idx = getInternalPos(key);
+  if(idx != -1){
     setInternal(key, stream.str(), idx);
   }
   else{
-    verifyVariableExistence(floatSettings, key);
+    verifyVariableExistence(myUserSettings->floatSettings, key);
     setExternal(key, stream.str());
   }
 }
@@ -411,26 +485,27 @@ void Settings::setFloat(const string& key, const float value)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setBool(const string& key, const bool value)
 {
-  std::ostringstream stream;
-  stream << value;
+  const string str = value ? "1" : "0";
 
-  if(int idx = getInternalPos(key) != -1){
-    setInternal(key, stream.str(), idx);
+  int idx = getInternalPos(key);
+  if(idx != -1){
+    setInternal(key, str, idx);
   }
   else{
-    verifyVariableExistence(boolSettings, key);
-    setExternal(key, stream.str());
+    verifyVariableExistence(myUserSettings->boolSettings, key);
+    setExternal(key, str);
   }
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setString(const string& key, const string& value)
 {
-  if(int idx = getInternalPos(key) != -1){
+  int idx = getInternalPos(key);
+  if(idx != -1){
     setInternal(key, value, idx);
   }
   else{
-    verifyVariableExistence(stringSettings, key);
+    verifyVariableExistence(myUserSettings->stringSettings, key);
     setExternal(key, value);
   }
 }
@@ -450,10 +525,10 @@ int Settings::getInt(const string& key, bool strict) const {
     // Try to find the named setting and answer its value
     int idx = -1;
     if((idx = getInternalPos(key)) != -1) {
-        return (int) atoi(myInternalSettings[idx].value.c_str());
+        return (int) atoi(myInternalSettings->settings[idx].value.c_str());
     } else { 
         if((idx = getExternalPos(key)) != -1) {
-            return (int) atoi(myExternalSettings[idx].value.c_str());
+            return (int) atoi(myExternalSettings->settings[idx].value.c_str());
         } else {
             if (strict) {
                 ale::Logger::Error << "No value found for key: " << key << ". ";
@@ -471,10 +546,10 @@ float Settings::getFloat(const string& key, bool strict) const {
     // Try to find the named setting and answer its value
     int idx = -1;
     if((idx = getInternalPos(key)) != -1) {
-        return (float) atof(myInternalSettings[idx].value.c_str());
+        return (float) atof(myInternalSettings->settings[idx].value.c_str());
     } else { 
         if((idx = getExternalPos(key)) != -1) {
-            return (float) atof(myExternalSettings[idx].value.c_str());
+            return (float) atof(myExternalSettings->settings[idx].value.c_str());
         } else {
             if (strict) {
                 ale::Logger::Error << "No value found for key: " << key << ". ";
@@ -493,7 +568,7 @@ bool Settings::getBool(const string& key, bool strict) const {
     int idx = -1;
     if((idx = getInternalPos(key)) != -1)
     {
-        const string& value = myInternalSettings[idx].value;
+        const string& value = myInternalSettings->settings[idx].value;
         if(value == "1" || value == "true" || value == "True")
             return true;
         else if(value == "0" || value == "false" || value == "False")
@@ -501,7 +576,7 @@ bool Settings::getBool(const string& key, bool strict) const {
         else
             return false;
     } else if((idx = getExternalPos(key)) != -1) {
-        const string& value = myExternalSettings[idx].value;
+        const string& value = myExternalSettings->settings[idx].value;
         if(value == "1" || value == "true")
             return true;
         else if(value == "0" || value == "false")
@@ -524,9 +599,9 @@ const string& Settings::getString(const string& key, bool strict) const {
     // Try to find the named setting and answer its value
     int idx = -1;
     if((idx = getInternalPos(key)) != -1) {
-        return myInternalSettings[idx].value;
+        return myInternalSettings->settings[idx].value;
     } else if ((idx = getExternalPos(key)) != -1) {
-        return myExternalSettings[idx].value;
+        return myExternalSettings->settings[idx].value;
     } else {
         if (strict) {
             ale::Logger::Error << "No value found for key: " << key << ". ";
@@ -550,111 +625,65 @@ void Settings::setSize(const string& key, const int value1, const int value2)
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::getInternalPos(const string& key) const
 {
-  for(unsigned int i = 0; i < myInternalSettings.size(); ++i)
-    if(myInternalSettings[i].key == key)
-      return i;
-
-  return -1;
+  return getPos(*myInternalSettings, key);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::getExternalPos(const string& key) const
 {
-  for(unsigned int i = 0; i < myExternalSettings.size(); ++i)
-    if(myExternalSettings[i].key == key)
-      return i;
+  return getPos(*myExternalSettings, key);
+}
 
-  return -1;
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Settings::getPos(const SettingsTable& table, const string& key)
+{
+  PositionMap::const_iterator it = table.positions->find(key);
+  return it == table.positions->end() ? -1 : it->second;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::setInternal(const string& key, const string& value,
                           int pos, bool useAsInitial)
 {
-  int idx = -1;
-
-  if(pos != -1 && pos >= 0 && pos < (int)myInternalSettings.size() &&
-     myInternalSettings[pos].key == key)
-  {
-    idx = pos;
-  }
-  else
-  {
-    for(unsigned int i = 0; i < myInternalSettings.size(); ++i)
-    {
-      if(myInternalSettings[i].key == key)
-      {
-        idx = i;
-        break;
-      }
-    }
-  }
-
-  if(idx != -1)
-  {
-    myInternalSettings[idx].key   = key;
-    myInternalSettings[idx].value = value;
-    if(useAsInitial) myInternalSettings[idx].initialValue = value;
-
-    /*cerr << "modify internal: key = " << key
-         << ", value  = " << value
-         << ", ivalue = " << myInternalSettings[idx].initialValue
-         << " @ index = " << idx
-         << endl;*/
-  }
-  else
-  {
-    Setting setting;
-    setting.key   = key;
-    setting.value = value;
-    if(useAsInitial) setting.initialValue = value;
-
-    myInternalSettings.push_back(setting);
-    idx = myInternalSettings.size() - 1;
-
-    /*cerr << "insert internal: key = " << key
-         << ", value  = " << value
-         << ", ivalue = " << setting.initialValue
-         << " @ index = " << idx
-         << endl;*/
-  }
-
-  return idx;
+  return set(myInternalSettings, key, value, pos, useAsInitial);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 int Settings::setExternal(const string& key, const string& value,
                           int pos, bool useAsInitial)
+{
+  return set(myExternalSettings, key, value, pos, useAsInitial);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+int Settings::set(shared_ptr<SettingsTable>& table, const string& key,
+                  const string& value, int pos, bool useAsInitial)
 {
   int idx = -1;
 
-  if(pos != -1 && pos >= 0 && pos < (int)myExternalSettings.size() &&
-     myExternalSettings[pos].key == key)
+  if(pos >= 0 && pos < (int)table->settings.size() &&
+     table->settings[pos].key == key)
   {
     idx = pos;
   }
   else
-  {
-    for(unsigned int i = 0; i < myExternalSettings.size(); ++i)
-    {
-      if(myExternalSettings[i].key == key)
-      {
-        idx = i;
-        break;
-      }
-    }
-  }
+    idx = getPos(*table, key);
+
+  // Setting the value a key already has changes nothing, and leaves the
+  // table shared
+  if(idx != -1 && !useAsInitial && table->settings[idx].value == value)
+    return idx;
+
+  // Give this object its own copy of a shared table before changing it
+  if(table.use_count() > 1)
+    table.reset(new SettingsTable(*table));
+
+  myIsValid = false;
 
   if(idx != -1)
   {
-    myExternalSettings[idx].key   = key;
-    myExternalSettings[idx].value = value;
-    if(useAsInitial) myExternalSettings[idx].initialValue = value;
-
-    /*cerr << "modify external: key = " << key
-         << ", value = " << value
-         << " @ index = " << idx
-         << endl;*/
+    table->settings[idx].value = value;
+    if(useAsInitial) table->settings[idx].initialValue = value;
   }
   else
   {
@@ -663,15 +692,14 @@ int Settings::setExternal(const string& key, const string& value,
     setting.value = value;
     if(useAsInitial) setting.initialValue = value;
 
-    myExternalSettings.push_back(setting);
-    idx = myExternalSettings.size() - 1;
-
-    /*cerr << "insert external: key = " << key
-         << ", value = " << value
-         << " @ index = " << idx
-         << endl;*/
+    table->settings.push_back(setting);
+    idx = table->settings.size() - 1;
+    if(table->positions.use_count() > 1)
+      table->positions.reset(new PositionMap(*table->positions));
+    (*table->positions)[key] = idx;
   }
 
+  updateTypedSetting(key);
   return idx;
 }
 
@@ -690,9 +718,17 @@ Settings& Settings::operator = (const Settings&)
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void Settings::setDefaultSettings() {
+    shared_ptr<UserSettings> userSettings(new UserSettings);
+    map<string, int>& intSettings = userSettings->intSettings;
+    map<string, bool>& boolSettings = userSettings->boolSettings;
+    map<string, float>& floatSettings = userSettings->floatSettings;
+    map<string, string>& stringSettings = userSettings->stringSettings;
 
     // Stella settings
-    stringSettings.insert(pair<string, string>("cpu", "low")); // Reduce CPU emulation fidelity for speed
+    stringSettings.insert(pair<string, string>("cpu", "low")); // Reduce CPU emulation fidelity for speed; "high", "fast" and "block" are cycle accurate
+    boolSettings.insert(pair<string, bool>("fast_tia_update", false)); // Keep collisions but draw no pixels
+    boolSettings.insert(pair<string, bool>("vector_tia_update", false)); // Draw scanlines with several objects 16 pixels at a time
+    boolSettings.insert(pair<string, bool>("check_tia_update", false)); // Draw with every renderer and log where they disagree
 
     // Controller settings
     intSettings.insert(pair<string, int>("max_num_frames", 0));
@@ -708,6 +744,15 @@ void Settings::setDefaultSettings() {
     boolSettings.insert(pair<string, bool>("send_rgb", false));
     intSettings.insert(pair<string, int>("frame_skip", 1));
     floatSettings.insert(pair<string, float>("repeat_action_probability", 0.25));
+    boolSettings.insert(pair<string, bool>("reset_cache", false));
+    boolSettings.insert(pair<string, bool>("compact_state", false));
+    boolSettings.insert(pair<string, bool>("render_skip", false));
+    boolSettings.insert(pair<string, bool>("compact_memory", false));
+    boolSettings.insert(pair<string, bool>("preprocess_observations", false));
+    intSettings.insert(pair<string, int>("observation_width", 84));
+    intSettings.insert(pair<string, int>("observation_height", 84));
+    intSettings.insert(pair<string, int>("observation_stack", 4));
+    boolSettings.insert(pair<string, bool>("observation_max_pool", true));
     stringSettings.insert(pair<string, string>("rom_file", ""));
 
     // Record settings
@@ -718,6 +763,8 @@ void Settings::setDefaultSettings() {
     // Display Settings
     boolSettings.insert(pair<string, bool>("display_screen", false));
 
+    myUserSettings = userSettings;
+
     for(map<string, string>::iterator it = stringSettings.begin(); it != stringSettings.end(); it++) {
       this->setString(it->first, it->second);
     }
@@ -735,9 +782,70 @@ void Settings::setDefaultSettings() {
     }
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Settings::updateTypedSetting(const string& key)
+{
+  if(key == "frame_skip")
+    myFrameSkip = getInt(key);
+  else if(key == "repeat_action_probability")
+    myRepeatActionProbability = getFloat(key);
+  else if(key == "color_averaging")
+    myColorAveraging = getBool(key);
+  else if(key == "max_num_frames_per_episode")
+    myMaxNumFramesPerEpisode = getInt(key);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Settings::memoryUsage() const
+{
+  return sizeof(*this) + memoryUsage(myInternalSettings) +
+         memoryUsage(myExternalSettings);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The heap memory of a string; short strings are kept in the string object
+// itself, up to the capacity of an empty string
+static uInt32 stringUsage(const string& str)
+{
+  static const string::size_type localCapacity = string().capacity();
+  return str.capacity() > localCapacity ? str.capacity() + 1 : 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 Settings::memoryUsage(const shared_ptr<SettingsTable>& table)
+{
+  if(table.use_count() > 1)
+    return 0;
+
+  uInt32 usage = sizeof(SettingsTable) +
+      table->settings.capacity() * sizeof(Setting);
+  for(unsigned int i = 0; i < table->settings.size(); ++i)
+  {
+    const Setting& setting = table->settings[i];
+    usage += stringUsage(setting.key) + stringUsage(setting.value) +
+        stringUsage(setting.initialValue);
+  }
+
+  if(table->positions.use_count() == 1)
+  {
+    usage += sizeof(PositionMap) +
+        table->positions->bucket_count() * sizeof(void*);
+
+    // Each position is a hash node holding a copy of the key. The node type
+    // is private to the library, so this is an estimate: a link and the
+    // cached hash code, as in libstdc++
+    for(unsigned int i = 0; i < table->settings.size(); ++i)
+      usage += 2 * sizeof(void*) + sizeof(pair<const string, int>) +
+          stringUsage(table->settings[i].key);
+  }
+
+  return usage;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 template<typename ValueType>
-void Settings::verifyVariableExistence(map<string, ValueType> dict, string key){
+void Settings::verifyVariableExistence(const map<string, ValueType>& dict,
+                                       const string& key) const {
     if(dict.find(key) == dict.end()){
       throw std::runtime_error("The key " + key + " you are trying to set does not exist.\n");
     }
@@ -22,9 +22,11 @@
 class OSystem;
 
 #include <map>
+#include <memory>
 #include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
-#include "../common/Array.hxx"
 #include "m6502/src/bspf/src/bspf.hxx"
 
 /**
@@ -57,6 +59,14 @@ class Settings
     */
     void loadConfig(const char* config_file);
 
+    /**
+      This method takes on the values of all the settings of another
+      settings object, without reading any file.
+
+      @param settings The settings to copy
+    */
+    void copy(const Settings& settings);
+
     /**
       This method should be called to save the current settings to an rc file.
     */
@@ -72,6 +82,7 @@ class Settings
     /**
       This method should be called *after* settings have been read,
       to validate (and change, if necessary) any improper settings.
+      It does nothing if no setting changed since the last call.
     */
     void validate();
 
@@ -165,8 +176,30 @@ class Settings
     */
     void setSize(const std::string& key, const int value1, const int value2);
 
+    /**
+      The values of the settings read every time an environment is
+      created, kept up to date as they are set.
+    */
+    int frameSkip() const { return myFrameSkip; }
+    float repeatActionProbability() const { return myRepeatActionProbability; }
+    bool colorAveraging() const { return myColorAveraging; }
+    int maxNumFramesPerEpisode() const { return myMaxNumFramesPerEpisode; }
+
+    /**
+      Get the memory used by the settings, not counting the tables they
+      still share with the default settings or with copies.
+
+      @return The number of bytes used
+    */
+    uInt32 memoryUsage() const;
 
   private:
+    // Create the default settings, which settings objects start as a copy of
+    Settings();
+
+    // The default settings, created on first use
+    static const Settings& defaults();
+
     // Copy constructor isn't supported by this class so make it private
     Settings(const Settings&);
 
@@ -184,6 +217,9 @@ class Settings
     // Sets all of the ALE-specific default settings
     void setDefaultSettings();
 
+    // Updates the typed copy of the given setting, if it has one
+    void updateTypedSetting(const std::string& key);
+
   protected:
     // The parent OSystem object
     OSystem* myOSystem;
@@ -195,12 +231,12 @@ class Settings
       std::string value;
       std::string initialValue;
     };
-    typedef Common::Array<Setting> SettingsArray;
+    typedef std::vector<Setting> SettingsArray;
 
     const SettingsArray& getInternalSettings() const
-      { return myInternalSettings; }
+      { return myInternalSettings->settings; }
     const SettingsArray& getExternalSettings() const
-      { return myExternalSettings; }
+      { return myExternalSettings->settings; }
 
     /** Get position in specified array of 'key' */
     int getInternalPos(const std::string& key) const;
@@ -215,20 +251,58 @@ class Settings
   private:
     //Maps containing all external settings an user can
     //define and their respectives default values.
-    std::map<std::string,int> intSettings;
-    std::map<std::string,bool> boolSettings;
-    std::map<std::string,float> floatSettings;
-    std::map<std::string,std::string> stringSettings;
+    struct UserSettings
+    {
+      std::map<std::string,int> intSettings;
+      std::map<std::string,bool> boolSettings;
+      std::map<std::string,float> floatSettings;
+      std::map<std::string,std::string> stringSettings;
+    };
     template<typename ValueType>
-    void verifyVariableExistence(std::map<std::string, ValueType> dict, std::string key);
+    void verifyVariableExistence(const std::map<std::string, ValueType>& dict,
+                                 const std::string& key) const;
+
+    // Key,value pairs and the positions of the keys in the array. Keys are
+    // rarely added, so copies of a table share the positions until then.
+    typedef std::unordered_map<std::string, int> PositionMap;
+    struct SettingsTable
+    {
+      SettingsArray settings;
+      std::shared_ptr<PositionMap> positions;
+    };
+
+    // Get the position of 'key' in the given table, or -1
+    static int getPos(const SettingsTable& table, const std::string& key);
+
+    // Add key,value pair to the given table at the specified position
+    int set(std::shared_ptr<SettingsTable>& table, const std::string& key,
+            const std::string& value, int pos, bool useAsInitial);
+
+    // Get the memory used by the given table, if no one else uses it
+    static uInt32 memoryUsage(const std::shared_ptr<SettingsTable>& table);
+
+    // The user settings never change once the defaults are created, so
+    // all settings objects share them
+    std::shared_ptr<const UserSettings> myUserSettings;
 
     // Holds key,value pairs that are necessary for Stella to
     // function and must be saved on each program exit.
-    SettingsArray myInternalSettings;
+    // The tables are shared with copies of the settings (and the defaults)
+    // until they are changed.
+    std::shared_ptr<SettingsTable> myInternalSettings;
 
     // Holds auxiliary key,value pairs that shouldn't be saved on
     // program exit.
-    SettingsArray myExternalSettings;
+    std::shared_ptr<SettingsTable> myExternalSettings;
+
+    // Typed copies of the settings returned by frameSkip() and friends
+    int myFrameSkip;
+    float myRepeatActionProbability;
+    bool myColorAveraging;
+    int myMaxNumFramesPerEpisode;
+
+    // Whether the settings are unchanged since they were last validated
+    bool myIsValid;
 };
 
 #endif
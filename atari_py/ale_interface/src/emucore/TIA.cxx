@@ -20,20 +20,31 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 
 #include "Console.hxx"
 #include "Control.hxx"
 #include "M6502.hxx"
+#include "OSystem.hxx"
 #include "System.hxx"
 #include "TIA.hxx"
 #include "Serializer.hxx"
 #include "Deserializer.hxx"
 #include "Settings.hxx"
 #include "Sound.hxx"
+#include "../common/Log.hpp"
+
+#ifdef TIA_VECTOR_SUPPORT
+  #include <emmintrin.h>
+#endif
+
 using namespace std;
 
 #define HBLANK 68
 
+// The lookup tables are shared by every TIA in the process
+static std::once_flag ourTablesComputed;
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 TIA::TIA(const Console& console, Settings& settings)
     : myConsole(console),
@@ -54,6 +65,7 @@ TIA::TIA(const Console& console, Settings& settings)
 
   myFrameGreyed = false;
   myPartialFrameFlag = false; //ALE : This was left uninitialized :(
+  myRenderingEnabled = myRenderFrame = true;
 
   for(i = 0; i < 6; ++i)
     myBitEnabled[i] = true;
@@ -95,17 +107,8 @@ TIA::TIA(const Console& console, Settings& settings)
     }
   }
 
-  for(i = 0; i < 640; ++i)
-    ourDisabledMaskTable[i] = 0;
-
   // Compute all of the mask tables
-  computeBallMaskTable();
-  computeCollisionTable();
-  computeMissleMaskTable();
-  computePlayerMaskTable();
-  computePlayerPositionResetWhenTable();
-  computePlayerReflectTable();
-  computePlayfieldMaskTable();
+  std::call_once(ourTablesComputed, &TIA::computeTables);
 
   // Init stats counters
   myFrameCounter = 0;
@@ -113,6 +116,8 @@ TIA::TIA(const Console& console, Settings& settings)
   myAUDV0 = myAUDV1 = myAUDF0 = myAUDF1 = myAUDC0 = myAUDC1 = 0;
 
   fastUpdate = settings.getBool("fast_tia_update", false);
+  myVectorUpdate = settings.getBool("vector_tia_update", false);
+  myCheckUpdate = settings.getBool("check_tia_update", false);
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -322,27 +327,27 @@ bool TIA::save(Serializer& out)
     out.putInt(myCurrentScanline);
     out.putInt(myVSYNCFinishClock);
 
-    out.putInt(myEnabledObjects);
+    out.putByte(myEnabledObjects);
 
-    out.putInt(myVSYNC);
-    out.putInt(myVBLANK);
-    out.putInt(myNUSIZ0);
-    out.putInt(myNUSIZ1);
+    out.putByte(myVSYNC);
+    out.putByte(myVBLANK);
+    out.putByte(myNUSIZ0);
+    out.putByte(myNUSIZ1);
 
     out.putInt(myCOLUP0);
     out.putInt(myCOLUP1);
     out.putInt(myCOLUPF);
     out.putInt(myCOLUBK);
 
-    out.putInt(myCTRLPF);
-    out.putInt(myPlayfieldPriorityAndScore);
+    out.putByte(myCTRLPF);
+    out.putByte(myPlayfieldPriorityAndScore);
     out.putBool(myREFP0);
     out.putBool(myREFP1);
     out.putInt(myPF);
-    out.putInt(myGRP0);
-    out.putInt(myGRP1);
-    out.putInt(myDGRP0);
-    out.putInt(myDGRP1);
+    out.putByte(myGRP0);
+    out.putByte(myGRP1);
+    out.putByte(myDGRP0);
+    out.putByte(myDGRP1);
     out.putBool(myENAM0);
     out.putBool(myENAM1);
     out.putBool(myENABL);
@@ -364,16 +369,21 @@ bool TIA::save(Serializer& out)
     out.putInt(myPOSM1);
     out.putInt(myPOSBL);
 
-    out.putInt(myCurrentGRP0);
-    out.putInt(myCurrentGRP1);
-
-// pointers
-//  myCurrentBLMask = ourBallMaskTable[0][0];
-//  myCurrentM0Mask = ourMissleMaskTable[0][0][0];
-//  myCurrentM1Mask = ourMissleMaskTable[0][0][0];
-//  myCurrentP0Mask = ourPlayerMaskTable[0][0][0];
-//  myCurrentP1Mask = ourPlayerMaskTable[0][0][0];
-//  myCurrentPFMask = ourPlayfieldTable[0];
+    out.putByte(myCurrentGRP0);
+    out.putByte(myCurrentGRP1);
+
+    // The object masks point into the static mask tables and are saved as
+    // offsets into them: the registers alone don't tell whether the first
+    // copy of a player is suppressed or a Cosmic Ark missile stretched or
+    // disabled (-1)
+    out.putInt(myCurrentBLMask - &ourBallMaskTable[0][0][0]);
+    out.putInt(myCurrentM0Mask == ourDisabledMaskTable ? -1 :
+        myCurrentM0Mask - &ourMissleMaskTable[0][0][0][0]);
+    out.putInt(myCurrentM1Mask == ourDisabledMaskTable ? -1 :
+        myCurrentM1Mask - &ourMissleMaskTable[0][0][0][0]);
+    out.putInt(myCurrentP0Mask - &ourPlayerMaskTable[0][0][0][0]);
+    out.putInt(myCurrentP1Mask - &ourPlayerMaskTable[0][0][0][0]);
+    out.putInt(myCurrentPFMask - &ourPlayfieldTable[0][0]);
 
     out.putInt(myLastHMOVEClock);
     out.putBool(myHMOVEBlankEnabled);
@@ -400,6 +410,32 @@ bool TIA::save(Serializer& out)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::copyFrameState(const MediaSource& source)
+{
+  // Consoles only ever have a TIA as their media source
+  const TIA& tia = static_cast<const TIA&>(source);
+
+  memcpy(myCurrentFrameBuffer, tia.myCurrentFrameBuffer, 160 * 300);
+  memcpy(myPreviousFrameBuffer, tia.myPreviousFrameBuffer, 160 * 300);
+  myFramePointer = myCurrentFrameBuffer +
+      (tia.myFramePointer - tia.myCurrentFrameBuffer);
+
+  myPartialFrameFlag = tia.myPartialFrameFlag;
+  myFrameGreyed = tia.myFrameGreyed;
+  myFrameCounter = tia.myFrameCounter;
+  myRenderingEnabled = tia.myRenderingEnabled;
+  myRenderFrame = tia.myRenderFrame;
+
+  // The masks point into the static tables, which all TIAs share
+  myCurrentBLMask = tia.myCurrentBLMask;
+  myCurrentM0Mask = tia.myCurrentM0Mask;
+  myCurrentM1Mask = tia.myCurrentM1Mask;
+  myCurrentP0Mask = tia.myCurrentP0Mask;
+  myCurrentP1Mask = tia.myCurrentP1Mask;
+  myCurrentPFMask = tia.myCurrentPFMask;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 bool TIA::load(Deserializer& in)
 {
@@ -419,27 +455,27 @@ bool TIA::load(Deserializer& in)
     myCurrentScanline = (Int32) in.getInt();
     myVSYNCFinishClock = (Int32) in.getInt();
 
-    myEnabledObjects = (uInt8) in.getInt();
+    myEnabledObjects = in.getByte();
 
-    myVSYNC = (uInt8) in.getInt();
-    myVBLANK = (uInt8) in.getInt();
-    myNUSIZ0 = (uInt8) in.getInt();
-    myNUSIZ1 = (uInt8) in.getInt();
+    myVSYNC = in.getByte();
+    myVBLANK = in.getByte();
+    myNUSIZ0 = in.getByte();
+    myNUSIZ1 = in.getByte();
 
     myCOLUP0 = (uInt32) in.getInt();
     myCOLUP1 = (uInt32) in.getInt();
     myCOLUPF = (uInt32) in.getInt();
     myCOLUBK = (uInt32) in.getInt();
 
-    myCTRLPF = (uInt8) in.getInt();
-    myPlayfieldPriorityAndScore = (uInt8) in.getInt();
+    myCTRLPF = in.getByte();
+    myPlayfieldPriorityAndScore = in.getByte();
     myREFP0 = in.getBool();
     myREFP1 = in.getBool();
     myPF = (uInt32) in.getInt();
-    myGRP0 = (uInt8) in.getInt();
-    myGRP1 = (uInt8) in.getInt();
-    myDGRP0 = (uInt8) in.getInt();
-    myDGRP1 = (uInt8) in.getInt();
+    myGRP0 = in.getByte();
+    myGRP1 = in.getByte();
+    myDGRP0 = in.getByte();
+    myDGRP1 = in.getByte();
     myENAM0 = in.getBool();
     myENAM1 = in.getBool();
     myENABL = in.getBool();
@@ -461,16 +497,20 @@ bool TIA::load(Deserializer& in)
     myPOSM1 = (Int16) in.getInt();
     myPOSBL = (Int16) in.getInt();
 
-    myCurrentGRP0 = (uInt8) in.getInt();
-    myCurrentGRP1 = (uInt8) in.getInt();
-
-// pointers
-//  myCurrentBLMask = ourBallMaskTable[0][0];
-//  myCurrentM0Mask = ourMissleMaskTable[0][0][0];
-//  myCurrentM1Mask = ourMissleMaskTable[0][0][0];
-//  myCurrentP0Mask = ourPlayerMaskTable[0][0][0];
-//  myCurrentP1Mask = ourPlayerMaskTable[0][0][0];
-//  myCurrentPFMask = ourPlayfieldTable[0];
+    myCurrentGRP0 = in.getByte();
+    myCurrentGRP1 = in.getByte();
+
+    Int32 offset = (Int32) in.getInt();
+    myCurrentBLMask = &ourBallMaskTable[0][0][0] + offset;
+    offset = (Int32) in.getInt();
+    myCurrentM0Mask = (offset < 0) ? ourDisabledMaskTable :
+        &ourMissleMaskTable[0][0][0][0] + offset;
+    offset = (Int32) in.getInt();
+    myCurrentM1Mask = (offset < 0) ? ourDisabledMaskTable :
+        &ourMissleMaskTable[0][0][0][0] + offset;
+    myCurrentP0Mask = &ourPlayerMaskTable[0][0][0][0] + (Int32) in.getInt();
+    myCurrentP1Mask = &ourPlayerMaskTable[0][0][0][0] + (Int32) in.getInt();
+    myCurrentPFMask = &ourPlayfieldTable[0][0] + (Int32) in.getInt();
 
     myLastHMOVEClock = (Int32) in.getInt();
     myHMOVEBlankEnabled = in.getBool();
@@ -500,6 +540,12 @@ bool TIA::load(Deserializer& in)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 TIA::memoryUsage() const
+{
+  return sizeof(*this) + 2 * 160 * 300;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::update()
 {
@@ -513,7 +559,15 @@ void TIA::update()
   myPartialFrameFlag = true;
 
   // Execute instructions until frame is finished, or a breakpoint/trap hits
-  mySystem->m6502().execute(25000);
+  {
+    ALE_PROFILE_SCOPE(myConsole.osystem().profiler(), CPU);
+#ifdef __USE_PROFILING
+    uInt64 instructions = mySystem->m6502().totalInstructionCount();
+#endif
+    mySystem->m6502().execute(25000);
+    ALE_PROFILE_COUNT(myConsole.osystem().profiler(), INSTRUCTIONS,
+        mySystem->m6502().totalInstructionCount() - instructions);
+  }
 
   // TODO: have code here that handles errors....
 
@@ -522,7 +576,7 @@ void TIA::update()
 
   if(myPartialFrameFlag) {
     // grey out old frame contents
-    if(!myFrameGreyed) greyOutFrame();
+    if(!myFrameGreyed && myRenderFrame) greyOutFrame();
     myFrameGreyed = true;
   } else {
     endFrame();
@@ -533,9 +587,14 @@ void TIA::update()
 inline void TIA::startFrame()
 {
   // This stuff should only happen at the beginning of a new frame.
-  uInt8* tmp = myCurrentFrameBuffer;
-  myCurrentFrameBuffer = myPreviousFrameBuffer;
-  myPreviousFrameBuffer = tmp;
+  // ALE: a frame that isn't drawn keeps the last drawn one current
+  myRenderFrame = myRenderingEnabled;
+  if(myRenderFrame)
+  {
+    uInt8* tmp = myCurrentFrameBuffer;
+    myCurrentFrameBuffer = myPreviousFrameBuffer;
+    myPreviousFrameBuffer = tmp;
+  }
 
   // Remember the number of clocks which have passed on the current scanline
   // so that we can adjust the frame's starting clock by this amount.  This
@@ -721,6 +780,21 @@ void TIA::setSound(Sound& sound)
   mySound = &sound;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::computeTables()
+{
+  for(uInt32 i = 0; i < 640; ++i)
+    ourDisabledMaskTable[i] = 0;
+
+  computeBallMaskTable();
+  computeCollisionTable();
+  computeMissleMaskTable();
+  computePlayerMaskTable();
+  computePlayerPositionResetWhenTable();
+  computePlayerReflectTable();
+  computePlayfieldMaskTable();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void TIA::computeBallMaskTable()
 {
@@ -1764,6 +1838,14 @@ inline void TIA::updateFrameScanline(uInt32 clocksToUpdate, uInt32 hpos)
       // Handle all of the other cases
       default:
       {
+#ifdef TIA_VECTOR_SUPPORT
+        if(myVectorUpdate)
+        {
+          updateFrameScanlineVector(clocksToUpdate, hpos);
+          break;
+        }
+#endif
+
         for(; myFramePointer < ending; ++myFramePointer, ++hpos)
         {
           uInt8 enabled = (myPF & myCurrentPFMask[hpos]) ? myPFBit : 0;
@@ -1794,6 +1876,205 @@ inline void TIA::updateFrameScanline(uInt32 clocksToUpdate, uInt32 hpos)
   myFramePointer = ending;
 }
 
+#ifdef TIA_VECTOR_SUPPORT
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static inline __m128i selectBytes(__m128i mask, __m128i a, __m128i b)
+{
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+static inline uInt8 orBytes(__m128i v)
+{
+  v = _mm_or_si128(v, _mm_srli_si128(v, 8));
+  v = _mm_or_si128(v, _mm_srli_si128(v, 4));
+  v = _mm_or_si128(v, _mm_srli_si128(v, 2));
+  v = _mm_or_si128(v, _mm_srli_si128(v, 1));
+  return (uInt8)_mm_cvtsi128_si32(v);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::updateFrameScanlineVector(uInt32 clocksToUpdate, uInt32 hpos)
+{
+  // Calculate the ending frame pointer value
+  uInt8* ending = myFramePointer + clocksToUpdate;
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_cmpeq_epi8(zero, zero);
+  const __m128i lanes =
+      _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+  const __m128i pf = _mm_set1_epi32(myPF);
+  const __m128i grp0 = _mm_set1_epi8(myCurrentGRP0);
+  const __m128i grp1 = _mm_set1_epi8(myCurrentGRP1);
+
+  // The missles and the ball only show when they're enabled
+  const __m128i m0Enabled = (myEnabledObjects & myM0Bit) ? ones : zero;
+  const __m128i m1Enabled = (myEnabledObjects & myM1Bit) ? ones : zero;
+  const __m128i blEnabled = (myEnabledObjects & myBLBit) ? ones : zero;
+
+  const __m128i colubk = _mm_set1_epi8((uInt8)myCOLUBK);
+  const __m128i colupf = _mm_set1_epi8((uInt8)myCOLUPF);
+  const __m128i colup0 = _mm_set1_epi8((uInt8)myCOLUP0);
+  const __m128i colup1 = _mm_set1_epi8((uInt8)myCOLUP1);
+
+  bool priority = (myPlayfieldPriorityAndScore & PriorityBit) != 0;
+  bool score = (myPlayfieldPriorityAndScore & ScoreBit) != 0;
+
+  // For each object, the objects it shared a pixel with
+  __m128i withP0 = zero, withM0 = zero, withP1 = zero, withM1 = zero,
+          withBL = zero, withPF = zero;
+
+  // Draw 16 pixels at a time and leave the rest to the loop below
+  for(; ending - myFramePointer >= 16; myFramePointer += 16, hpos += 16)
+  {
+    // Every pixel of each object, as bytes of all ones
+    const __m128i* mask = (const __m128i*)&myCurrentPFMask[hpos];
+    __m128i pf0 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(mask), pf), zero);
+    __m128i pf1 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(mask + 1), pf), zero);
+    __m128i pf2 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(mask + 2), pf), zero);
+    __m128i pf3 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(mask + 3), pf), zero);
+    __m128i mPF = _mm_xor_si128(_mm_packs_epi16(_mm_packs_epi32(pf0, pf1),
+        _mm_packs_epi32(pf2, pf3)), ones);
+
+    __m128i mP0 = _mm_xor_si128(_mm_cmpeq_epi8(_mm_and_si128(
+        _mm_loadu_si128((const __m128i*)&myCurrentP0Mask[hpos]), grp0), zero), ones);
+    __m128i mP1 = _mm_xor_si128(_mm_cmpeq_epi8(_mm_and_si128(
+        _mm_loadu_si128((const __m128i*)&myCurrentP1Mask[hpos]), grp1), zero), ones);
+    __m128i mM0 = _mm_andnot_si128(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i*)&myCurrentM0Mask[hpos]), zero), m0Enabled);
+    __m128i mM1 = _mm_andnot_si128(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i*)&myCurrentM1Mask[hpos]), zero), m1Enabled);
+    __m128i mBL = _mm_andnot_si128(_mm_cmpeq_epi8(
+        _mm_loadu_si128((const __m128i*)&myCurrentBLMask[hpos]), zero), blEnabled);
+
+    // The objects on each pixel, as the bits of ourCollisionTable
+    __m128i enabled = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(mP0, _mm_set1_epi8(myP0Bit)),
+                     _mm_and_si128(mM0, _mm_set1_epi8(myM0Bit))),
+        _mm_or_si128(_mm_or_si128(_mm_and_si128(mP1, _mm_set1_epi8(myP1Bit)),
+                                  _mm_and_si128(mM1, _mm_set1_epi8(myM1Bit))),
+                     _mm_or_si128(_mm_and_si128(mBL, _mm_set1_epi8(myBLBit)),
+                                  _mm_and_si128(mPF, _mm_set1_epi8(myPFBit)))));
+
+    withP0 = _mm_or_si128(withP0, _mm_and_si128(mP0, enabled));
+    withM0 = _mm_or_si128(withM0, _mm_and_si128(mM0, enabled));
+    withP1 = _mm_or_si128(withP1, _mm_and_si128(mP1, enabled));
+    withM1 = _mm_or_si128(withM1, _mm_and_si128(mM1, enabled));
+    withBL = _mm_or_si128(withBL, _mm_and_si128(mBL, enabled));
+    withPF = _mm_or_si128(withPF, _mm_and_si128(mPF, enabled));
+
+    // Paint from the lowest priority up, as myPriorityEncoder orders them
+    __m128i player0 = _mm_or_si128(mP0, mM0);
+    __m128i player1 = _mm_or_si128(mP1, mM1);
+    __m128i color = colubk;
+    if(priority)
+    {
+      color = selectBytes(player1, colup1, color);
+      color = selectBytes(player0, colup0, color);
+      color = selectBytes(_mm_or_si128(mBL, mPF), colupf, color);
+    }
+    else
+    {
+      // In score mode the playfield takes the color of the player on its
+      // side, and player 1 doesn't cover the left side of it
+      __m128i left = zero;
+      if(score && (hpos < 80))
+        left = _mm_cmpgt_epi8(_mm_set1_epi8((Int8)BSPF_min(80U - hpos, 16U)), lanes);
+      __m128i playfield = score ? selectBytes(left, colup0, colup1) : colupf;
+
+      color = selectBytes(mBL, colupf, color);
+      color = selectBytes(mPF, playfield, color);
+      color = selectBytes(_mm_andnot_si128(_mm_and_si128(mPF, left), player1),
+                          colup1, color);
+      color = selectBytes(player0, colup0, color);
+    }
+    _mm_storeu_si128((__m128i*)myFramePointer, color);
+  }
+
+  // Each pair of objects that shared a pixel collided
+  static const uInt8 objects[6] =
+      { myP0Bit, myM0Bit, myP1Bit, myM1Bit, myBLBit, myPFBit };
+  const uInt8 with[6] = { orBytes(withP0), orBytes(withM0), orBytes(withP1),
+                          orBytes(withM1), orBytes(withBL), orBytes(withPF) };
+  for(uInt32 i = 0; i < 6; ++i)
+  {
+    for(uInt32 j = i + 1; j < 6; ++j)
+    {
+      if(with[i] & objects[j])
+        myCollision |= ourCollisionTable[objects[i] | objects[j]];
+    }
+  }
+
+  for(; myFramePointer < ending; ++myFramePointer, ++hpos)
+  {
+    uInt8 enabled = (myPF & myCurrentPFMask[hpos]) ? myPFBit : 0;
+
+    if((myEnabledObjects & myBLBit) && myCurrentBLMask[hpos])
+      enabled |= myBLBit;
+
+    if(myCurrentGRP1 & myCurrentP1Mask[hpos])
+      enabled |= myP1Bit;
+
+    if((myEnabledObjects & myM1Bit) && myCurrentM1Mask[hpos])
+      enabled |= myM1Bit;
+
+    if(myCurrentGRP0 & myCurrentP0Mask[hpos])
+      enabled |= myP0Bit;
+
+    if((myEnabledObjects & myM0Bit) && myCurrentM0Mask[hpos])
+      enabled |= myM0Bit;
+
+    myCollision |= ourCollisionTable[enabled];
+    *myFramePointer = myColor[myPriorityEncoder[hpos < 80 ? 0 : 1]
+        [enabled | myPlayfieldPriorityAndScore]];
+  }
+}
+#endif
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void TIA::checkFrameScanline(uInt32 clocksToUpdate, uInt32 hpos)
+{
+  uInt8* start = myFramePointer;
+  uInt16 collision = myCollision;
+  bool vectorUpdate = myVectorUpdate;
+
+  updateFrameScanlineFast(clocksToUpdate, hpos);
+  uInt16 fastCollision = myCollision;
+
+#ifdef TIA_VECTOR_SUPPORT
+  uInt8 vectorPixels[160];
+  myFramePointer = start;
+  myCollision = collision;
+  myVectorUpdate = true;
+  updateFrameScanline(clocksToUpdate, hpos);
+  memcpy(vectorPixels, start, clocksToUpdate);
+  uInt16 vectorCollision = myCollision;
+#endif
+
+  // The frame keeps what the per pixel renderer draws
+  myFramePointer = start;
+  myCollision = collision;
+  myVectorUpdate = false;
+  updateFrameScanline(clocksToUpdate, hpos);
+  myVectorUpdate = vectorUpdate;
+
+  if(fastCollision != myCollision)
+  {
+    ale::Logger::Error << "TIA: fast update collisions " << fastCollision
+                       << " differ from " << myCollision << " on scanline "
+                       << scanlines() << " at " << hpos << endl;
+  }
+#ifdef TIA_VECTOR_SUPPORT
+  if((vectorCollision != myCollision) ||
+     (memcmp(vectorPixels, start, clocksToUpdate) != 0))
+  {
+    ale::Logger::Error << "TIA: vector update differs on scanline "
+                       << scanlines() << " at " << hpos << endl;
+  }
+#endif
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 inline void TIA::updateFrame(Int32 clock)
 {
@@ -1806,6 +2087,8 @@ inline void TIA::updateFrame(Int32 clock)
     return;
   }
 
+  ALE_PROFILE_SCOPE(myConsole.osystem().profiler(), TIA_UPDATE);
+
   // Truncate the number of cycles to update to the stop display point
   if(clock > myClockStopDisplay)
   {
@@ -1859,9 +2142,11 @@ inline void TIA::updateFrame(Int32 clock)
     // Update as much of the scanline as we can
     if(clocksToUpdate != 0)
     {
-      if (fastUpdate)
+      if (fastUpdate || !myRenderFrame)
         updateFrameScanlineFast(clocksToUpdate, 
           clocksFromStartOfScanLine - HBLANK);
+      else if (myCheckUpdate)
+        checkFrameScanline(clocksToUpdate, clocksFromStartOfScanLine - HBLANK);
       else
         updateFrameScanline(clocksToUpdate, clocksFromStartOfScanLine - HBLANK);
     }
@@ -1871,7 +2156,8 @@ inline void TIA::updateFrame(Int32 clock)
         (clocksFromStartOfScanLine < (HBLANK + 8)))
     {
       Int32 blanks = (HBLANK + 8) - clocksFromStartOfScanLine;
-      memset(oldFramePointer, 0, blanks);
+      if(myRenderFrame)
+        memset(oldFramePointer, 0, blanks);
 
       if((clocksToUpdate + clocksFromStartOfScanLine) >= (HBLANK + 8))
       {
@@ -30,6 +30,12 @@ class Settings;
 #include "m6502/src/Device.hxx"
 #include "MediaSrc.hxx"
 
+// Scanlines can be drawn 16 pixels at a time with SSE2, which every x86-64
+// processor has
+#if defined(__SSE2__)
+  #define TIA_VECTOR_SUPPORT
+#endif
+
 /**
   This class is a device that emulates the Television Interface Adapator 
   found in the Atari 2600 and 7800 consoles.  The Television Interface 
@@ -111,6 +117,13 @@ class TIA : public Device , public MediaSource
     */
     virtual bool load(Deserializer& in);
 
+    /**
+      Get the memory used by the device.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
   public:
     /**
       Get the byte at the specified address
@@ -171,6 +184,32 @@ class TIA : public Device , public MediaSource
     */
     uInt32 scanlines() const;
 
+    /**
+      Answers whether the last update stopped before the frame was
+      finished, in which case the next update continues that frame.
+
+      @return True if the current frame is only partially emulated
+    */
+    bool partialFrame() const { return myPartialFrameFlag; }
+
+    /**
+      Enables or disables drawing frames into the frame buffers. Frames
+      that are not drawn are emulated exactly, but leave both frame buffers
+      untouched. The setting takes effect from the next frame on.
+
+      @param enable Whether frames should be drawn
+    */
+    void enableRendering(bool enable) { myRenderingEnabled = enable; }
+
+    /**
+      Copies what the saved state of another TIA leaves out: both frame
+      buffers, how far the current frame got, and the object graphics in
+      use.
+
+      @param source The TIA to copy
+    */
+    void copyFrameState(const MediaSource& source);
+
     /**
       Answers the current color clock we've gotten to on this scanline.
 
@@ -234,26 +273,29 @@ class TIA : public Device , public MediaSource
 #endif
 
   private:
+    // Compute the shared lookup tables below; runs once per process
+    static void computeTables();
+
     // Compute the ball mask table
-    void computeBallMaskTable();
+    static void computeBallMaskTable();
 
     // Compute the collision decode table
-    void computeCollisionTable();
+    static void computeCollisionTable();
 
     // Compute the missle mask table
-    void computeMissleMaskTable();
+    static void computeMissleMaskTable();
 
     // Compute the player mask table
-    void computePlayerMaskTable();
+    static void computePlayerMaskTable();
 
     // Compute the player position reset when table
-    void computePlayerPositionResetWhenTable();
+    static void computePlayerPositionResetWhenTable();
 
     // Compute the player reflect table
-    void computePlayerReflectTable();
+    static void computePlayerReflectTable();
 
     // Compute playfield mask table
-    void computePlayfieldMaskTable();
+    static void computePlayfieldMaskTable();
 
   private:
     // Update the current frame buffer up to one scanline
@@ -554,10 +596,29 @@ class TIA : public Device , public MediaSource
   /** ALE-specific */
   private:
     bool fastUpdate;
+
+    // Whether frames should be drawn, and whether the current one is
+    bool myRenderingEnabled;
+    bool myRenderFrame;
    
     // Updates the frame's scanline but not the frame buffer 
     void updateFrameScanlineFast(uInt32 clocksToUpdate, uInt32 hpos);
 
+    // Whether scanlines with several objects are drawn with vector
+    // instructions, and whether every renderer draws them to be compared
+    bool myVectorUpdate;
+    bool myCheckUpdate;
+
+#ifdef TIA_VECTOR_SUPPORT
+    // Draws the objects of the frame's scanline 16 pixels at a time, the
+    // same as the general case of updateFrameScanline()
+    void updateFrameScanlineVector(uInt32 clocksToUpdate, uInt32 hpos);
+#endif
+
+    // Draws the frame's scanline with updateFrameScanline(), then checks
+    // that the vector and fast updates give the same pixels and collisions
+    void checkFrameScanline(uInt32 clocksToUpdate, uInt32 hpos);
+
 };
 
 #endif
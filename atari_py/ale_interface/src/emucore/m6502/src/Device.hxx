@@ -89,6 +89,14 @@ class Device
     */
     virtual bool load(Deserializer& in) = 0;
 
+    /**
+      Get the memory used by the device, including what it allocated
+      itself but not what it shares with the devices of other systems.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const = 0;
+
   public:
     /**
       Get the byte at the specified address
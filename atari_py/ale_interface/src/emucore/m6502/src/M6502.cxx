@@ -17,12 +17,16 @@
 //============================================================================
 
 #include "M6502.hxx"
+#include <mutex>
 
 #ifdef DEBUGGER_SUPPORT
   #include "Expression.hxx"
 #endif
 using namespace std;
 
+// The BCD table is shared by every processor in the process
+static std::once_flag ourBCDTableComputed;
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 M6502::M6502(uInt32 systemCyclesPerProcessorCycle)
     : myExecutionStatus(0),
@@ -37,15 +41,10 @@ M6502::M6502(uInt32 systemCyclesPerProcessorCycle)
 #endif
 
   // Compute the BCD lookup table
-  uInt16 t;
-  for(t = 0; t < 256; ++t)
-  {
-    ourBCDTable[0][t] = ((t >> 4) * 10) + (t & 0x0f);
-    ourBCDTable[1][t] = (((t % 100) / 10) << 4) | (t % 10);
-  }
+  std::call_once(ourBCDTableComputed, &M6502::computeBCDTable);
 
   // Compute the System Cycle table
-  for(t = 0; t < 256; ++t)
+  for(uInt16 t = 0; t < 256; ++t)
   {
     myInstructionSystemCycleTable[t] = ourInstructionProcessorCycleTable[t] *
         mySystemCyclesPerProcessorCycle;
@@ -63,6 +62,16 @@ M6502::~M6502()
 #endif
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void M6502::computeBCDTable()
+{
+  for(uInt16 t = 0; t < 256; ++t)
+  {
+    ourBCDTable[0][t] = ((t >> 4) * 10) + (t & 0x0f);
+    ourBCDTable[1][t] = (((t % 100) / 10) << 4) | (t % 10);
+  }
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void M6502::install(System& system)
 {
@@ -128,6 +128,14 @@ class M6502
     */
     virtual const char* name() const = 0;
 
+    /**
+      Get the memory used by the processor, including what it allocated
+      itself.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const = 0;
+
   public:
     /**
       Get the addressing mode of the specified instruction
@@ -190,6 +198,14 @@ class M6502
     friend std::ostream& operator<<(std::ostream& out, const AddressingMode& mode);
 
   public:
+    /**
+      Answers the number of instructions executed since the processor
+      was created.
+
+      @return The total instruction count
+    */
+    uInt64 totalInstructionCount() const { return myTotalInstructionCount; }
+
 #ifdef DEBUGGER_SUPPORT
     /**
       Attach the specified debugger.
@@ -201,7 +217,6 @@ class M6502
     // TODO - document these methods
     void setBreakPoints(PackedBitArray *bp);
     void setTraps(PackedBitArray *read, PackedBitArray *write);
-    int totalInstructionCount() { return myTotalInstructionCount; }
 
     unsigned int addCondBreak(Expression *e, string name);
     void delCondBreak(unsigned int brk);
@@ -298,6 +313,9 @@ class M6502
     /// Lookup table used for binary-code-decimal math
     static uInt8 ourBCDTable[2][256];
 
+    /// Fills ourBCDTable; runs once per process
+    static void computeBCDTable();
+
     /**
       Table of instruction processor cycle times.  In some cases additional 
       cycles will be added during the execution of an instruction.
@@ -307,7 +325,7 @@ class M6502
     /// Table of instruction mnemonics
     static const char* ourInstructionMnemonicTable[256];
 
-    int myTotalInstructionCount;
+    uInt64 myTotalInstructionCount;
 };
 
 #endif
@@ -0,0 +1,360 @@
+//============================================================================
+//
+// MM     MM  6666  555555  0000   2222
+// MMMM MMMM 66  66 55     00  00 22  22
+// MM MMM MM 66     55     00  00     22
+// MM  M  MM 66666  55555  00  00  22222  --  "A 6502 Microprocessor Emulator"
+// MM     MM 66  66     55 00  00 22
+// MM     MM 66  66 55  55 00  00 22
+// MM     MM  6666   5555   0000  222222
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#include "M6502Block.hxx"
+
+#ifdef THREADED_DISPATCH_SUPPORT
+
+using namespace std;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+M6502Block::M6502Block(uInt32 systemCyclesPerProcessorCycle)
+    : M6502Fast(systemCyclesPerProcessorCycle)
+{
+  myWritableMemoryChanges = 0;
+  myPageAccessChanges = 0;
+  myNextInstruction = myBlockEnd = 0;
+  myOperands = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+M6502Block::~M6502Block()
+{
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void M6502Block::install(System& system)
+{
+  M6502Fast::install(system);
+
+  // The system sets every page when it's created, so its count of page
+  // access changes is never zero and these entries start out stale
+  IndexEntry stale = { 0, 0 };
+  myIndex.assign(ourWindowSize, stale);
+  myBlocks.clear();
+}
+
+// Ends the instruction and jumps straight to the handler of the next one
+// of the block, if it's still valid
+#define M6502_NEXT_INSTRUCTION \
+  flushCycles(); \
+  myTotalInstructionCount++; \
+  if(myExecutionStatus || (--number == 0)) \
+    goto stopped; \
+  if((myNextInstruction == myBlockEnd) || \
+     (mySystem->pageAccessChanges() != myPageAccessChanges)) \
+    goto dispatch; \
+  M6502_BLOCK_INSTRUCTION
+
+// Starts the next instruction of the running block, the same as peek() of
+// its opcode from a directly read page would
+#define M6502_BLOCK_INSTRUCTION \
+  IR = myNextInstruction->opcode; \
+  myOperands = myNextInstruction->operands; \
+  ++myPendingCycles; \
+  ++PC; \
+  mySystem->setDataBusState(IR); \
+  myLastAccessWasRead = true; \
+  goto *(myNextInstruction++)->handler
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool M6502Block::execute(uInt32 number)
+{
+  static const void* const ourHandlers[256] = M6502_FAST_HANDLERS;
+
+  uInt16 operandAddress = 0;
+  uInt8 operand = 0;
+
+  // Clear all of the execution status bits except for the fatal error bit
+  myExecutionStatus &= FatalErrorBit;
+
+  // The registers may have been changed since the last call
+  myNextInstruction = myBlockEnd = 0;
+
+  // Loop until execution is stopped or a fatal error occurs
+  for(;;)
+  {
+    if(!myExecutionStatus && (number != 0))
+    {
+    dispatch:
+      // A bank switch may have changed the code under the running block
+      if(mySystem->pageAccessChanges() != myPageAccessChanges)
+      {
+        myPageAccessChanges = mySystem->pageAccessChanges();
+        myNextInstruction = myBlockEnd;
+      }
+
+      if((myNextInstruction == myBlockEnd) && (PC & ourWindowBase))
+      {
+        IndexEntry& entry = myIndex[PC & (ourWindowSize - 1)];
+        if(entry.pageAccessChanges != myPageAccessChanges)
+        {
+          entry.block = findBlock(PC, ourHandlers);
+          entry.pageAccessChanges = myPageAccessChanges;
+        }
+
+        // Devices may change memory they map for reading only, so the
+        // code is checked every time its block is entered
+        const Block* block = entry.block;
+        if((block != 0) &&
+           (memcmp(block->memory, &block->code[0], block->code.size()) != 0))
+        {
+          block = entry.block = findBlock(PC, ourHandlers);
+        }
+        if(block != 0)
+        {
+          myNextInstruction = &block->instructions[0];
+          myBlockEnd = myNextInstruction + block->instructions.size();
+        }
+      }
+
+      if(myNextInstruction != myBlockEnd)
+      {
+        M6502_BLOCK_INSTRUCTION;
+      }
+
+      IR = peek(PC++);
+      myOperands = 0;
+      goto *ourHandlers[IR];
+
+      // 6502 instruction emulation is generated by an M4 macro file
+      #include "M6502Block.ins"
+
+    illegal:
+      // Oops, illegal instruction executed so set fatal error flag
+      myExecutionStatus |= FatalErrorBit;
+      M6502_NEXT_INSTRUCTION;
+    }
+
+  stopped:
+    // An interrupt moves the program counter away from the running block
+    myNextInstruction = myBlockEnd;
+
+    // See if we need to handle an interrupt
+    if((myExecutionStatus & MaskableInterruptBit) || 
+        (myExecutionStatus & NonmaskableInterruptBit))
+    {
+      // Yes, so handle the interrupt
+      interruptHandler();
+    }
+
+    // See if execution has been stopped
+    if(myExecutionStatus & StopExecutionBit)
+    {
+      // Yes, so answer that everything finished fine
+      return true;
+    }
+
+    // See if a fatal error has occured
+    if(myExecutionStatus & FatalErrorBit)
+    {
+      // Yes, so answer that something when wrong
+      return false;
+    }
+
+    // See if we've executed the specified number of instructions
+    if(number == 0)
+    {
+      // Yes, so answer that everything finished fine
+      return true;
+    }
+  }
+}
+
+#undef M6502_NEXT_INSTRUCTION
+#undef M6502_BLOCK_INSTRUCTION
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const M6502Block::Block* M6502Block::findBlock(uInt16 address,
+                                              const void* const* handlers)
+{
+  const System::PageAccess& access = mySystem->getPageAccessFor(address);
+  if(access.directPeekBase == 0)
+    return 0;
+
+  uInt16 pageOffset = address & mySystem->pageMask();
+  const uInt8* code = access.directPeekBase + pageOffset;
+
+  // A block may run on into the following pages while they read the
+  // memory that comes next
+  uInt32 available = mySystem->pageMask() + 1 - pageOffset;
+  while(available < ourMaxBlockBytes)
+  {
+    const System::PageAccess& next =
+        mySystem->getPageAccessFor(address + available);
+    if(next.directPeekBase != code + available)
+      break;
+    available += mySystem->pageMask() + 1;
+  }
+  available = BSPF_min(available, (uInt32)ourMaxBlockBytes);
+
+  if(isWritable(code, available))
+    return 0;
+
+  // Start over rather than keep the blocks of every bank ever run
+  if((myBlocks.size() >= ourMaxBlocks) && (myBlocks.count(code) == 0))
+  {
+    IndexEntry stale = { 0, 0 };
+    myIndex.assign(ourWindowSize, stale);
+    myBlocks.clear();
+  }
+
+  // The memory may have been reloaded since the block was decoded
+  Block& block = myBlocks[code];
+  if(block.instructions.empty() || (block.pageOffset != pageOffset) ||
+     (block.code.size() > available) ||
+     (memcmp(&block.code[0], code, block.code.size()) != 0))
+  {
+    decodeBlock(code, available, handlers, block);
+    block.pageOffset = pageOffset;
+    block.memory = code;
+  }
+
+  return block.instructions.empty() ? 0 : &block;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void M6502Block::decodeBlock(const uInt8* code, uInt32 available,
+                             const void* const* handlers, Block& block)
+{
+  vector<uInt32> offsets;
+  uInt32 size = 0;
+  while((offsets.size() < ourMaxBlockInstructions) && (size < available))
+  {
+    uInt8 opcode = code[size];
+
+    uInt32 length;
+    switch(ourAddressingModeTable[opcode])
+    {
+      case Implied:
+        length = 1;
+        break;
+
+      case Immediate: case IndirectX: case IndirectY: case Relative:
+      case Zero: case ZeroX: case ZeroY:
+        length = 2;
+        break;
+
+      case Absolute: case AbsoluteX: case AbsoluteY: case Indirect:
+        length = 3;
+        break;
+
+      default:
+        length = 0;
+        break;
+    }
+
+    // Leave illegal instructions and those running into memory that may
+    // belong to another bank to the interpreter
+    if((length == 0) || (size + length > available))
+      break;
+
+    offsets.push_back(size);
+    size += length;
+
+    // Stop after anything that changes the program counter
+    if((ourAddressingModeTable[opcode] == Relative) || (opcode == 0x00) ||
+       (opcode == 0x20) || (opcode == 0x40) || (opcode == 0x4c) ||
+       (opcode == 0x60) || (opcode == 0x6c))
+      break;
+  }
+
+  block.code.assign(code, code + size);
+  block.instructions.resize(offsets.size());
+  for(uInt32 i = 0; i < offsets.size(); ++i)
+  {
+    block.instructions[i].opcode = block.code[offsets[i]];
+    block.instructions[i].handler = handlers[block.code[offsets[i]]];
+    block.instructions[i].operands = &block.code[0] + offsets[i] + 1;
+  }
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool M6502Block::isWritable(const uInt8* begin, uInt32 size)
+{
+  // Gather the memory mapped for writing once per memory map
+  if(myWritableMemoryChanges != mySystem->pageAccessChanges())
+  {
+    uInt32 pageSize = mySystem->pageMask() + 1;
+    myWritableMemory.clear();
+    for(uInt32 page = 0; page < mySystem->numberOfPages(); ++page)
+    {
+      const System::PageAccess& access =
+          mySystem->getPageAccessFor(page << mySystem->pageShift());
+      if(access.directPokeBase != 0)
+      {
+        myWritableMemory.push_back(make_pair(access.directPokeBase,
+                                             access.directPokeBase + pageSize));
+      }
+    }
+
+    // Mirrors map the same memory many times over, so merge the ranges
+    sort(myWritableMemory.begin(), myWritableMemory.end());
+    uInt32 merged = 0;
+    for(uInt32 i = 1; i < myWritableMemory.size(); ++i)
+    {
+      if(myWritableMemory[i].first <= myWritableMemory[merged].second)
+      {
+        myWritableMemory[merged].second = BSPF_max(
+            myWritableMemory[merged].second, myWritableMemory[i].second);
+      }
+      else
+        myWritableMemory[++merged] = myWritableMemory[i];
+    }
+    if(!myWritableMemory.empty())
+      myWritableMemory.resize(merged + 1);
+
+    myWritableMemoryChanges = mySystem->pageAccessChanges();
+  }
+
+  const uInt8* end = begin + size;
+  for(uInt32 i = 0; i < myWritableMemory.size(); ++i)
+  {
+    if((begin < myWritableMemory[i].second) && (myWritableMemory[i].first < end))
+      return true;
+  }
+  return false;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const char* M6502Block::name() const
+{
+  return "M6502Block";
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 M6502Block::memoryUsage() const
+{
+  uInt32 usage = sizeof(*this) + myIndex.capacity() * sizeof(IndexEntry) +
+      myWritableMemory.capacity() * sizeof(myWritableMemory[0]);
+
+  // Each block is a tree node of the map (links and colour take four words),
+  // with its code and instructions
+  for(std::map<const uInt8*, Block>::const_iterator it = myBlocks.begin();
+      it != myBlocks.end(); ++it)
+  {
+    usage += sizeof(*it) + 4 * sizeof(void*) + it->second.code.capacity() +
+        it->second.instructions.capacity() * sizeof(Instruction);
+  }
+
+  return usage;
+}
+
+#endif
@@ -0,0 +1,218 @@
+//============================================================================
+//
+// MM     MM  6666  555555  0000   2222
+// MMMM MMMM 66  66 55     00  00 22  22
+// MM MMM MM 66     55     00  00     22
+// MM  M  MM 66666  55555  00  00  22222  --  "A 6502 Microprocessor Emulator"
+// MM     MM 66  66     55 00  00 22
+// MM     MM 66  66 55  55 00  00 22
+// MM     MM  6666   5555   0000  222222
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#ifndef M6502BLOCK_HXX
+#define M6502BLOCK_HXX
+
+class M6502Block;
+
+#include <map>
+#include <vector>
+
+#include "bspf/src/bspf.hxx"
+#include "M6502Fast.hxx"
+
+/**
+  This class provides a high compatibility 6502 microprocessor emulator
+  that decodes straight-line code once into blocks of instructions and
+  replays them.  A block starts at an address the processor jumps to and
+  ends at the next branch, jump, call or return, or where the pages stop
+  reading consecutive memory.  Blocks are only built from the cartridge
+  window (A12 set) and from memory that is read directly and that no
+  page maps for writing, which leaves out the RIOT RAM and cartridge
+  RAM; such code runs one instruction at a time as in M6502Fast.
+
+  Blocks are kept by the memory they were decoded from, so each bank of
+  a cartridge has its own, and are checked against that memory every
+  time they are entered, so memory a device changes through poke() or
+  patch() is decoded again before it next runs.  When a page access
+  method changes, e.g. on a bank switch, the rest of the running block
+  is dropped.
+
+  Apart from skipping the lookups of opcodes, operands and handlers, the
+  accesses and cycle counts are those of M6502Fast and so of M6502High.
+*/
+class M6502Block : public M6502Fast
+{
+  public:
+    /**
+      Create a new block cache 6502 microprocessor with the specified
+      cycle multiplier.
+
+      @param systemCyclesPerProcessorCycle The cycle multiplier
+    */
+    M6502Block(uInt32 systemCyclesPerProcessorCycle);
+
+    /**
+      Destructor
+    */
+    virtual ~M6502Block();
+
+  public:
+    /**
+      Install the processor in the specified system.  Invoked by the
+      system when the processor is attached to it.
+
+      @param system The system the processor should install itself in
+    */
+    virtual void install(System& system);
+
+    /**
+      Execute instructions until the specified number of instructions
+      is executed, someone stops execution, or an error occurs.  Answers
+      true iff execution stops normally.
+
+      @param number Indicates the number of instructions to execute
+      @return true iff execution stops normally
+    */
+    virtual bool execute(uInt32 number);
+
+    /**
+      Get a null terminated string which is the processors's name (i.e. "M6532")
+
+      @return The name of the device
+    */
+    virtual const char* name() const;
+
+    /**
+      Get the memory used by the processor.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
+  protected:
+    /**
+      Get the next operand byte of the current instruction, from its
+      block if it has one and from memory otherwise
+
+      @return The operand byte
+    */
+    inline uInt8 fetch();
+
+  private:
+    // An instruction of a block: its handler in execute() and its operands
+    struct Instruction
+    {
+      const void* handler;
+      const uInt8* operands;
+      uInt8 opcode;
+    };
+
+    // Straight-line code decoded from memory
+    struct Block
+    {
+      // Offset of the first instruction within its page
+      uInt16 pageOffset;
+
+      // The memory the block was decoded from
+      const uInt8* memory;
+
+      // The contents of that memory, to check it against
+      std::vector<uInt8> code;
+
+      std::vector<Instruction> instructions;
+    };
+
+    // The block at an address, valid while the memory map is unchanged
+    struct IndexEntry
+    {
+      const Block* block;
+      uInt64 pageAccessChanges;
+    };
+
+    /**
+      Get the block starting at the specified address, decoding it if it
+      is not cached.
+
+      @param address The address of the first instruction
+      @param handlers The handler of each opcode
+      @return The block, or the null pointer if the code can't be cached
+    */
+    const Block* findBlock(uInt16 address, const void* const* handlers);
+
+    /**
+      Decode the instructions in the given memory into the given block.
+
+      @param code The memory of the first instruction
+      @param available The number of bytes the block may span
+      @param handlers The handler of each opcode
+      @param block The block to fill
+    */
+    void decodeBlock(const uInt8* code, uInt32 available,
+                     const void* const* handlers, Block& block);
+
+    /**
+      Answer whether any page maps the given memory for writing
+
+      @param begin The first byte of the memory
+      @param size The number of bytes
+      @return true iff the memory can be poked
+    */
+    bool isWritable(const uInt8* begin, uInt32 size);
+
+  private:
+    // Maximum number of instructions and bytes in a block
+    enum { ourMaxBlockInstructions = 32, ourMaxBlockBytes = 96 };
+
+    // The addresses blocks are built for: the 2600 maps the cartridge
+    // wherever A12 is set, and the TIA and RIOT everywhere else
+    enum { ourWindowBase = 0x1000, ourWindowSize = 0x1000 };
+
+    // Maximum number of decoded blocks; all are dropped when it's reached
+    enum { ourMaxBlocks = 2048 };
+
+    // The decoded blocks, by the memory they start at
+    std::map<const uInt8*, Block> myBlocks;
+
+    // The block at each address of the cartridge window
+    std::vector<IndexEntry> myIndex;
+
+    // Memory that pages map for writing, as begin and end pointers
+    std::vector<std::pair<const uInt8*, const uInt8*> > myWritableMemory;
+
+    // The page access changes myWritableMemory was gathered for
+    uInt64 myWritableMemoryChanges;
+
+    // The page access changes the running block was found with
+    uInt64 myPageAccessChanges;
+
+    // The next instruction of the running block and the end of the block
+    const Instruction* myNextInstruction;
+    const Instruction* myBlockEnd;
+
+    // The remaining operand bytes of the current instruction, or the null
+    // pointer if it was fetched from memory
+    const uInt8* myOperands;
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline uInt8 M6502Block::fetch()
+{
+  if(myOperands == 0)
+    return peek(PC++);
+
+  // The same as peek() of a directly read page
+  ++myPendingCycles;
+  ++PC;
+  uInt8 result = *myOperands++;
+  mySystem->setDataBusState(result);
+  myLastAccessWasRead = true;
+  return result;
+}
+
+#endif
@@ -0,0 +1,231 @@
+//============================================================================
+//
+// MM     MM  6666  555555  0000   2222
+// MMMM MMMM 66  66 55     00  00 22  22
+// MM MMM MM 66     55     00  00     22
+// MM  M  MM 66666  55555  00  00  22222  --  "A 6502 Microprocessor Emulator"
+// MM     MM 66  66     55 00  00 22
+// MM     MM 66  66 55  55 00  00 22
+// MM     MM  6666   5555   0000  222222
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#include "M6502Fast.hxx"
+#include "Serializer.hxx"
+#include "Deserializer.hxx"
+
+#ifdef THREADED_DISPATCH_SUPPORT
+
+using namespace std;
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+M6502Fast::M6502Fast(uInt32 systemCyclesPerProcessorCycle)
+    : M6502(systemCyclesPerProcessorCycle)
+{
+  myPendingCycles = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+M6502Fast::~M6502Fast()
+{
+}
+
+// Ends the instruction and jumps straight to the handler of the next one
+#define M6502_NEXT_INSTRUCTION \
+  flushCycles(); \
+  myTotalInstructionCount++; \
+  if(myExecutionStatus || (--number == 0)) \
+    goto stopped; \
+  IR = peek(PC++); \
+  goto *ourHandlers[IR]
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool M6502Fast::execute(uInt32 number)
+{
+  static const void* const ourHandlers[256] = M6502_FAST_HANDLERS;
+
+  uInt16 operandAddress = 0;
+  uInt8 operand = 0;
+
+  // Clear all of the execution status bits except for the fatal error bit
+  myExecutionStatus &= FatalErrorBit;
+
+  // Loop until execution is stopped or a fatal error occurs
+  for(;;)
+  {
+    if(!myExecutionStatus && (number != 0))
+    {
+      // Fetch the first instruction, each handler then fetches the next
+      IR = peek(PC++);
+      goto *ourHandlers[IR];
+
+      // 6502 instruction emulation is generated by an M4 macro file
+      #include "M6502Fast.ins"
+
+    illegal:
+      // Oops, illegal instruction executed so set fatal error flag
+      myExecutionStatus |= FatalErrorBit;
+      M6502_NEXT_INSTRUCTION;
+    }
+
+  stopped:
+    // See if we need to handle an interrupt
+    if((myExecutionStatus & MaskableInterruptBit) || 
+        (myExecutionStatus & NonmaskableInterruptBit))
+    {
+      // Yes, so handle the interrupt
+      interruptHandler();
+    }
+
+    // See if execution has been stopped
+    if(myExecutionStatus & StopExecutionBit)
+    {
+      // Yes, so answer that everything finished fine
+      return true;
+    }
+
+    // See if a fatal error has occured
+    if(myExecutionStatus & FatalErrorBit)
+    {
+      // Yes, so answer that something when wrong
+      return false;
+    }
+
+    // See if we've executed the specified number of instructions
+    if(number == 0)
+    {
+      // Yes, so answer that everything finished fine
+      return true;
+    }
+  }
+}
+
+#undef M6502_NEXT_INSTRUCTION
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void M6502Fast::interruptHandler()
+{
+  // Handle the interrupt
+  if((myExecutionStatus & MaskableInterruptBit) && !I)
+  {
+    mySystem->incrementCycles(7 * mySystemCyclesPerProcessorCycle);
+    mySystem->poke(0x0100 + SP--, (PC - 1) >> 8);
+    mySystem->poke(0x0100 + SP--, (PC - 1) & 0x00ff);
+    mySystem->poke(0x0100 + SP--, PS() & (~0x10));
+    D = false;
+    I = true;
+    PC = (uInt16)mySystem->peek(0xFFFE) | ((uInt16)mySystem->peek(0xFFFF) << 8);
+  }
+  else if(myExecutionStatus & NonmaskableInterruptBit)
+  {
+    mySystem->incrementCycles(7 * mySystemCyclesPerProcessorCycle);
+    mySystem->poke(0x0100 + SP--, (PC - 1) >> 8);
+    mySystem->poke(0x0100 + SP--, (PC - 1) & 0x00ff);
+    mySystem->poke(0x0100 + SP--, PS() & (~0x10));
+    D = false;
+    PC = (uInt16)mySystem->peek(0xFFFA) | ((uInt16)mySystem->peek(0xFFFB) << 8);
+  }
+
+  // Clear the interrupt bits in myExecutionStatus
+  myExecutionStatus &= ~(MaskableInterruptBit | NonmaskableInterruptBit);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool M6502Fast::save(Serializer& out)
+{
+  string CPU = name();
+
+  try
+  {
+    out.putString(CPU);
+
+    out.putInt(A);    // Accumulator
+    out.putInt(X);    // X index register
+    out.putInt(Y);    // Y index register
+    out.putInt(SP);   // Stack Pointer
+    out.putInt(IR);   // Instruction register
+    out.putInt(PC);   // Program Counter
+
+    out.putBool(N);     // N flag for processor status register
+    out.putBool(V);     // V flag for processor status register
+    out.putBool(B);     // B flag for processor status register
+    out.putBool(D);     // D flag for processor status register
+    out.putBool(I);     // I flag for processor status register
+    out.putBool(notZ);  // Z flag complement for processor status register
+    out.putBool(C);     // C flag for processor status register
+
+    out.putInt(myExecutionStatus);
+  }
+  catch(char *msg)
+  {
+    cerr << msg << endl;
+    return false;
+  }
+  catch(...)
+  {
+    cerr << "Unknown error in save state for " << CPU << endl;
+    return false;
+  }
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+bool M6502Fast::load(Deserializer& in)
+{
+  string CPU = name();
+
+  try
+  {
+    if(in.getString() != CPU)
+      return false;
+
+    A = (uInt8) in.getInt();    // Accumulator
+    X = (uInt8) in.getInt();    // X index register
+    Y = (uInt8) in.getInt();    // Y index register
+    SP = (uInt8) in.getInt();   // Stack Pointer
+    IR = (uInt8) in.getInt();   // Instruction register
+    PC = (uInt16) in.getInt();  // Program Counter
+
+    N = in.getBool();     // N flag for processor status register
+    V = in.getBool();     // V flag for processor status register
+    B = in.getBool();     // B flag for processor status register
+    D = in.getBool();     // D flag for processor status register
+    I = in.getBool();     // I flag for processor status register
+    notZ = in.getBool();  // Z flag complement for processor status register
+    C = in.getBool();     // C flag for processor status register
+
+    myExecutionStatus = (uInt8) in.getInt();
+  }
+  catch(char *msg)
+  {
+    cerr << msg << endl;
+    return false;
+  }
+  catch(...)
+  {
+    cerr << "Unknown error in load state for " << CPU << endl;
+    return false;
+  }
+
+  return true;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+const char* M6502Fast::name() const
+{
+  return "M6502Fast";
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 M6502Fast::memoryUsage() const
+{
+  return sizeof(*this);
+}
+
+#endif
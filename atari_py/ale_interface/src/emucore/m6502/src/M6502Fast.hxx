@@ -0,0 +1,231 @@
+//============================================================================
+//
+// MM     MM  6666  555555  0000   2222
+// MMMM MMMM 66  66 55     00  00 22  22
+// MM MMM MM 66     55     00  00     22
+// MM  M  MM 66666  55555  00  00  22222  --  "A 6502 Microprocessor Emulator"
+// MM     MM 66  66     55 00  00 22
+// MM     MM 66  66 55  55 00  00 22
+// MM     MM  6666   5555   0000  222222
+//
+// Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+//
+// See the file "license" for information on usage and redistribution of
+// this file, and for a DISCLAIMER OF ALL WARRANTIES.
+//
+//============================================================================
+
+#ifndef M6502FAST_HXX
+#define M6502FAST_HXX
+
+class M6502Fast;
+class Serializer;
+class Deserializer;
+
+#include "bspf/src/bspf.hxx"
+#include "M6502.hxx"
+#include "System.hxx"
+
+// Threaded dispatch jumps through a table of label addresses, which is an
+// extension of GCC and Clang
+#if defined(__GNUC__)
+  #define THREADED_DISPATCH_SUPPORT
+#endif
+
+// The handler of each opcode as labelled in the instruction files generated
+// from M6502Fast.m4 and M6502Block.m4, to initialize the dispatch table of
+// execute()
+#define M6502_FAST_HANDLERS { \
+    &&op00, &&op01, &&illegal, &&op03, &&op04, &&op05, &&op06, &&op07, \
+    &&op08, &&op09, &&op0a, &&op0b, &&op0c, &&op0d, &&op0e, &&op0f, \
+    &&op10, &&op11, &&illegal, &&op13, &&op14, &&op15, &&op16, &&op17, \
+    &&op18, &&op19, &&op1a, &&op1b, &&op1c, &&op1d, &&op1e, &&op1f, \
+    &&op20, &&op21, &&illegal, &&op23, &&op24, &&op25, &&op26, &&op27, \
+    &&op28, &&op29, &&op2a, &&op2b, &&op2c, &&op2d, &&op2e, &&op2f, \
+    &&op30, &&op31, &&illegal, &&op33, &&op34, &&op35, &&op36, &&op37, \
+    &&op38, &&op39, &&op3a, &&op3b, &&op3c, &&op3d, &&op3e, &&op3f, \
+    &&op40, &&op41, &&illegal, &&op43, &&op44, &&op45, &&op46, &&op47, \
+    &&op48, &&op49, &&op4a, &&op4b, &&op4c, &&op4d, &&op4e, &&op4f, \
+    &&op50, &&op51, &&illegal, &&op53, &&op54, &&op55, &&op56, &&op57, \
+    &&op58, &&op59, &&op5a, &&op5b, &&op5c, &&op5d, &&op5e, &&op5f, \
+    &&op60, &&op61, &&illegal, &&op63, &&op64, &&op65, &&op66, &&op67, \
+    &&op68, &&op69, &&op6a, &&op6b, &&op6c, &&op6d, &&op6e, &&op6f, \
+    &&op70, &&op71, &&illegal, &&op73, &&op74, &&op75, &&op76, &&op77, \
+    &&op78, &&op79, &&op7a, &&op7b, &&op7c, &&op7d, &&op7e, &&op7f, \
+    &&op80, &&op81, &&op82, &&op83, &&op84, &&op85, &&op86, &&op87, \
+    &&op88, &&op89, &&op8a, &&op8b, &&op8c, &&op8d, &&op8e, &&op8f, \
+    &&op90, &&op91, &&illegal, &&op93, &&op94, &&op95, &&op96, &&op97, \
+    &&op98, &&op99, &&op9a, &&op9b, &&op9c, &&op9d, &&op9e, &&op9f, \
+    &&opa0, &&opa1, &&opa2, &&opa3, &&opa4, &&opa5, &&opa6, &&opa7, \
+    &&opa8, &&opa9, &&opaa, &&opab, &&opac, &&opad, &&opae, &&opaf, \
+    &&opb0, &&opb1, &&illegal, &&opb3, &&opb4, &&opb5, &&opb6, &&opb7, \
+    &&opb8, &&opb9, &&opba, &&opbb, &&opbc, &&opbd, &&opbe, &&opbf, \
+    &&opc0, &&opc1, &&opc2, &&opc3, &&opc4, &&opc5, &&opc6, &&opc7, \
+    &&opc8, &&opc9, &&opca, &&opcb, &&opcc, &&opcd, &&opce, &&opcf, \
+    &&opd0, &&opd1, &&illegal, &&opd3, &&opd4, &&opd5, &&opd6, &&opd7, \
+    &&opd8, &&opd9, &&opda, &&opdb, &&opdc, &&opdd, &&opde, &&opdf, \
+    &&ope0, &&ope1, &&ope2, &&ope3, &&ope4, &&ope5, &&ope6, &&ope7, \
+    &&ope8, &&ope9, &&opea, &&opeb, &&opec, &&oped, &&opee, &&opef, \
+    &&opf0, &&opf1, &&illegal, &&opf3, &&opf4, &&opf5, &&opf6, &&opf7, \
+    &&opf8, &&opf9, &&opfa, &&opfb, &&opfc, &&opfd, &&opfe, &&opff \
+  }
+
+/**
+  This class provides a high compatibility 6502 microprocessor emulator
+  that dispatches instructions through a table of label addresses instead
+  of a switch.  It makes the same memory accesses as M6502High and the
+  devices see the same cycle count on each access, but:
+
+    1. Cycles are added to the system once per instruction, and before
+       an access only when the access reaches a device
+
+    2. Distinct accesses are not counted, so this emulator can't drive
+       the Supercharger
+
+    3. Traps and breakpoints of the debugger are ignored
+*/
+class M6502Fast : public M6502
+{
+  public:
+    /**
+      Create a new threaded dispatch 6502 microprocessor with the specified
+      cycle multiplier.
+
+      @param systemCyclesPerProcessorCycle The cycle multiplier
+    */
+    M6502Fast(uInt32 systemCyclesPerProcessorCycle);
+
+    /**
+      Destructor
+    */
+    virtual ~M6502Fast();
+
+  public:
+    /**
+      Execute instructions until the specified number of instructions
+      is executed, someone stops execution, or an error occurs.  Answers
+      true iff execution stops normally.
+
+      @param number Indicates the number of instructions to execute
+      @return true iff execution stops normally
+    */
+    virtual bool execute(uInt32 number);
+
+    /**
+      Saves the current state of this device to the given Serializer.
+
+      @param out The serializer device to save to.
+      @return The result of the save.  True on success, false on failure.
+    */
+    virtual bool save(Serializer& out);
+
+    /**
+      Loads the current state of this device from the given Deserializer.
+
+      @param in The deserializer device to load from.
+      @return The result of the load.  True on success, false on failure.
+    */
+    virtual bool load(Deserializer& in);
+
+    /**
+      Get a null terminated string which is the processors's name (i.e. "M6532")
+
+      @return The name of the device
+    */
+    virtual const char* name() const;
+
+    /**
+      Get the memory used by the processor.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
+  protected:
+    /**
+      Called after an interrupt has be requested using irq() or nmi()
+    */
+    void interruptHandler();
+
+  protected:
+    /*
+      Get the byte at the specified address, first bringing the system
+      cycle count up to date if the address belongs to a device
+
+      @return The byte at the specified address
+    */
+    inline uInt8 peek(uInt16 address);
+
+    /**
+      Change the byte at the specified address to the given value, first
+      bringing the system cycle count up to date if the address belongs
+      to a device
+
+      @param address The address where the value should be stored
+      @param value The value to be stored at the address
+    */
+    inline void poke(uInt16 address, uInt8 value);
+
+    /**
+      Add the cycles of the current instruction that the system hasn't
+      seen yet
+    */
+    inline void flushCycles();
+
+  protected:
+    // Cycles of the current instruction not yet added to the system
+    uInt32 myPendingCycles;
+};
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void M6502Fast::flushCycles()
+{
+  mySystem->incrementCycles(myPendingCycles * mySystemCyclesPerProcessorCycle);
+  myPendingCycles = 0;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline uInt8 M6502Fast::peek(uInt16 address)
+{
+  ++myPendingCycles;
+
+  uInt8 result;
+  const System::PageAccess& access = mySystem->getPageAccessFor(address);
+  if(access.directPeekBase != 0)
+  {
+    result = *(access.directPeekBase + (address & mySystem->pageMask()));
+  }
+  else
+  {
+    // Devices may look at the cycle count, which M6502High updates before
+    // every access
+    flushCycles();
+    result = access.device->peek(address);
+  }
+
+  mySystem->setDataBusState(result);
+  myLastAccessWasRead = true;
+  return result;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void M6502Fast::poke(uInt16 address, uInt8 value)
+{
+  ++myPendingCycles;
+
+  const System::PageAccess& access = mySystem->getPageAccessFor(address);
+  if(access.directPokeBase != 0)
+  {
+    *(access.directPokeBase + (address & mySystem->pageMask())) = value;
+  }
+  else
+  {
+    flushCycles();
+    access.device->poke(address, value);
+  }
+
+  mySystem->setDataBusState(value);
+  myLastAccessWasRead = false;
+}
+
+#endif
@@ -331,3 +331,9 @@ const char* M6502High::name() const
 {
   return "M6502High";
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 M6502High::memoryUsage() const
+{
+  return sizeof(*this);
+}
@@ -87,6 +87,13 @@ class M6502High : public M6502
     */
     virtual const char* name() const;
 
+    /**
+      Get the memory used by the processor.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
   public:
     /**
       Get the number of memory accesses to distinct memory locations
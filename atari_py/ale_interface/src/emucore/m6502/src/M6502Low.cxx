@@ -143,6 +143,8 @@ bool M6502Low::execute(uInt32 number)
           cerr << "Illegal Instruction! " << hex << (int) IR << endl;
       }
 
+      myTotalInstructionCount++;
+
 #ifdef DEBUG
       debugStream << hex << setw(4) << operandAddress << " ";
       debugStream << setw(4) << ourInstructionMnemonicTable[IR];
@@ -302,3 +304,9 @@ const char* M6502Low::name() const
 {
   return "M6502Low";
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 M6502Low::memoryUsage() const
+{
+  return sizeof(*this);
+}
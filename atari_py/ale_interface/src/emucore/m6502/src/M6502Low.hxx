@@ -93,6 +93,13 @@ class M6502Low : public M6502
     */
     virtual const char* name() const;
 
+    /**
+      Get the memory used by the processor.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
   protected:
     /**
       Called after an interrupt has be requested using irq() or nmi()
@@ -72,3 +72,9 @@ bool NullDevice::load(Deserializer& in)
 {
   return true;
 }
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 NullDevice::memoryUsage() const
+{
+  return sizeof(*this);
+}
@@ -84,6 +84,13 @@ class NullDevice : public Device
     */
     virtual bool load(Deserializer& in);
 
+    /**
+      Get the memory used by the device.
+
+      @return The number of bytes used
+    */
+    virtual uInt32 memoryUsage() const;
+
   public:
     /**
       Get the byte at the specified address
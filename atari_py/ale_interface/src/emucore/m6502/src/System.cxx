@@ -37,7 +37,8 @@ System::System(uInt16 n, uInt16 m)
     myM6502(0),
     myTIA(0),
     myCycles(0),
-    myDataBusState(0)
+    myDataBusState(0),
+    myPageAccessChanges(0)
 {
   // Make sure the arguments are reasonable
   assert((1 <= m) && (m <= n) && (n <= 16));
@@ -169,6 +170,12 @@ bool System::load(Deserializer& in)
   return true;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+uInt32 System::memoryUsage() const
+{
+  return sizeof(*this) + myNumberOfPages * sizeof(PageAccess);
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void System::resetCycles()
 {
@@ -192,6 +199,7 @@ void System::setPageAccess(uInt16 page, const PageAccess& access)
   assert(access.device != 0);
 
   myPageAccessTable[page] = access;
+  ++myPageAccessChanges;
 }
 
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -302,52 +310,6 @@ System& System::operator = (const System&)
   return *this;
 }
 
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-uInt8 System::peek(uInt16 addr) 
-{
-  PageAccess& access = myPageAccessTable[(addr & myAddressMask) >> myPageShift];
-
-  uInt8 result;
- 
-  // See if this page uses direct accessing or not 
-  if(access.directPeekBase != 0)
-  {
-    result = *(access.directPeekBase + (addr & myPageMask));
-  }
-  else
-  {
-    result = access.device->peek(addr);
-  }
-
-#ifdef DEBUGGER_SUPPORT
-  if(!myDataBusLocked)
-#endif
-    myDataBusState = result;
-
-  return result;
-}
-
-// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-void System::poke(uInt16 addr, uInt8 value)
-{
-  PageAccess& access = myPageAccessTable[(addr & myAddressMask) >> myPageShift];
-  
-  // See if this page uses direct accessing or not 
-  if(access.directPokeBase != 0)
-  {
-    *(access.directPokeBase + (addr & myPageMask)) = value;
-  }
-  else
-  {
-    access.device->poke(addr, value);
-  }
-
-#ifdef DEBUGGER_SUPPORT
-  if(!myDataBusLocked)
-#endif
-    myDataBusState = value;
-}
-
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 void System::lockDataBus()
 {
@@ -40,11 +40,12 @@ class Deserializer;
   In general the addressing space will be 8192 (2^13) bytes for a 
   6507 based system and 65536 (2^16) bytes for a 6502 based system.
 
+  Processors that cache decoded code can watch pageAccessChanges() to
+  learn when a page access method changes, e.g. on a bank switch.
+
   TODO: To allow for dynamic code generation we probably need to
         add a tag to each page that indicates if it is read only
-        memory.  We also need to notify the processor anytime a
-        page access method is changed so that it can clear the
-        dynamic code for that page of memory.
+        memory.
 
   @author  Bradford W. Mott
   @version $Id: System.hxx,v 1.16 2007/01/01 18:04:51 stephena Exp $
@@ -89,6 +90,14 @@ class System
     */
     bool load(Deserializer& in);
 
+    /**
+      Get the memory used by the system itself, not counting the attached
+      devices and processor.
+
+      @return The number of bytes used
+    */
+    uInt32 memoryUsage() const;
+
   public:
     /**
       Attach the specified device and claim ownership of it.  The device 
@@ -199,7 +208,7 @@ class System
     {
       return myPageMask;
     }
- 
+
   public:
     /**
       Get the number of system cycles which have passed since the last
@@ -242,21 +251,23 @@ class System
     /**
       Get the byte at the specified address.  No masking of the
       address occurs before it's sent to the device mapped at
-      the address.
+      the address.  Pages with a direct peek base are read without
+      calling the device.
 
       @return The byte at the specified address
     */
-    uInt8 peek(uInt16 address);
+    inline uInt8 peek(uInt16 address);
 
     /**
       Change the byte at the specified address to the given value.
       No masking of the address occurs before it's sent to the device
-      mapped at the address.
+      mapped at the address.  Pages with a direct poke base are
+      written without calling the device.
 
       @param address The address where the value should be stored
       @param value The value to be stored at the address
     */
-    void poke(uInt16 address, uInt8 value);
+    inline void poke(uInt16 address, uInt8 value);
 
     /**
       Lock/unlock the data bus. When the bus is locked, peek() and
@@ -270,6 +281,15 @@ class System
     void lockDataBus();
     void unlockDataBus();
 
+    /**
+      Get the 128 bytes of RAM the RIOT maps at 0x80-0xFF.  Unlike peek(),
+      reading them this way neither goes through a device nor changes the
+      state of the data bus.
+
+      @return The RAM, which stays valid as long as the RIOT is installed
+    */
+    const uInt8* ram() const;
+
   public:
     /**
       Structure used to specify access methods for a page
@@ -282,7 +302,7 @@ class System
         to this page, while other values are the base address of an array 
         to directly access for reads to this page.
       */
-      uInt8* directPeekBase;
+      const uInt8* directPeekBase;
 
       /**
         Pointer to a block of memory or the null pointer.  The null pointer
@@ -314,7 +334,36 @@ class System
       @return The accessing methods used by the page
     */
     const PageAccess& getPageAccess(uInt16 page);
- 
+
+    /**
+      Get the page accessing method for the page holding the specified
+      address.  A processor can use it to access memory pages without
+      going through peek() and poke(), updating the data bus itself.
+
+      @param address The address to get accessing methods for
+      @return The accessing methods used by the page
+    */
+    const PageAccess& getPageAccessFor(uInt16 address) const;
+
+    /**
+      Set the state of the data bus after an access that didn't go
+      through peek() or poke().
+
+      @param value The data that was accessed
+    */
+    void setDataBusState(uInt8 value);
+
+    /**
+      Get the number of times a page access method has been set.  It
+      changes whenever the memory map does, e.g. on a bank switch.
+
+      @return The number of calls to setPageAccess()
+    */
+    uInt64 pageAccessChanges() const
+    {
+      return myPageAccessChanges;
+    }
+
   private:
     // Mask to apply to an address before accessing memory
     const uInt16 myAddressMask;
@@ -324,7 +373,7 @@ class System
 
     // Mask to apply to an address to obtain its page offset
     const uInt16 myPageMask;
- 
+
     // Number of pages in the system
     const uInt16 myNumberOfPages;
 
@@ -357,6 +406,11 @@ class System
     // debugger is active.
     bool myDataBusLocked;
 
+    // Number of times a page access method has been set.  Bank switches
+    // set pages all the time, so this is 64 bits wide to never wrap around
+    // to a value processors have seen before
+    uInt64 myPageAccessChanges;
+
   private:
     // Copy constructor isn't supported by this class so make it private
     System(const System&);
@@ -371,4 +425,72 @@ inline uInt8 System::getDataBusState() const
   return myDataBusState;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline const uInt8* System::ram() const
+{
+  // The RIOT installs its RAM for direct access, one page after the other
+  return myPageAccessTable[0x0080 >> myPageShift].directPeekBase;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline const System::PageAccess& System::getPageAccessFor(uInt16 address) const
+{
+  return myPageAccessTable[(address & myAddressMask) >> myPageShift];
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void System::setDataBusState(uInt8 value)
+{
+#ifdef DEBUGGER_SUPPORT
+  if(!myDataBusLocked)
+#endif
+    myDataBusState = value;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline uInt8 System::peek(uInt16 addr)
+{
+  const PageAccess& access = myPageAccessTable[(addr & myAddressMask) >> myPageShift];
+
+  uInt8 result;
+
+  // See if this page uses direct accessing or not
+  if(access.directPeekBase != 0)
+  {
+    result = *(access.directPeekBase + (addr & myPageMask));
+  }
+  else
+  {
+    result = access.device->peek(addr);
+  }
+
+#ifdef DEBUGGER_SUPPORT
+  if(!myDataBusLocked)
+#endif
+    myDataBusState = result;
+
+  return result;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+inline void System::poke(uInt16 addr, uInt8 value)
+{
+  const PageAccess& access = myPageAccessTable[(addr & myAddressMask) >> myPageShift];
+
+  // See if this page uses direct accessing or not
+  if(access.directPokeBase != 0)
+  {
+    *(access.directPokeBase + (addr & myPageMask)) = value;
+  }
+  else
+  {
+    access.device->poke(addr, value);
+  }
+
+#ifdef DEBUGGER_SUPPORT
+  if(!myDataBusLocked)
+#endif
+    myDataBusState = value;
+}
+
 #endif
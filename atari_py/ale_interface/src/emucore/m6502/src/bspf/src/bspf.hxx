@@ -39,6 +39,10 @@ typedef unsigned short uInt16;
 typedef signed int Int32;
 typedef unsigned int uInt32;
 
+// Types for 64-bit signed and unsigned integers
+typedef signed long long Int64;
+typedef unsigned long long uInt64;
+
 // The following code should provide access to the standard C++ objects and
 // types: cerr, cerr, string, ostream, istream, etc.
 #ifdef BSPF_OLD_STYLE_CXX_HEADERS
@@ -32,6 +32,12 @@ class ALEScreen {
 
     ALEScreen& operator=(const ALEScreen &rhs);
 
+    /** Shows the given pixels instead of a copy of them, which saves the memory of the
+      * screen; the pixels must stay valid as long as they are shown. NULL gives the
+      * screen its own pixels back, as shown last. Copies of a screen always have their
+      * own pixels. */
+    void view(pixel_t *pixels);
+
     /** pixel accessors, (row, column)-ordered */
     pixel_t get(int r, int c) const;
     pixel_t *pixel(int r, int c);
@@ -40,7 +46,7 @@ class ALEScreen {
     pixel_t *getRow(int r) const;
     
     /** Access the whole array */
-    pixel_t *getArray() const { return const_cast<pixel_t *>(&m_pixels[0]); }
+    pixel_t *getArray() const { return m_data; }
 
     /** Dimensionality information */
     size_t height() const { return m_rows; }
@@ -52,62 +58,83 @@ class ALEScreen {
     /** Returns whether two screens are equal */
     bool equals(const ALEScreen &rhs) const;
 
+    /** Returns the memory the screen allocated for its pixels, none while it views others */
+    size_t memoryUsage() const { return m_pixels.capacity() * sizeof(pixel_t); }
+
   protected:
     int m_rows;
     int m_columns;
 
     std::vector<pixel_t> m_pixels; 
+    // The pixels shown: those of m_pixels, unless the screen views others
+    pixel_t *m_data;
 };
 
 inline ALEScreen::ALEScreen(int h, int w):
   m_rows(h),
   m_columns(w),
   // Create a pixel array of the requisite size
-  m_pixels(m_rows * m_columns) {
+  m_pixels(m_rows * m_columns),
+  m_data(&m_pixels[0]) {
 }
 
 inline ALEScreen::ALEScreen(const ALEScreen &rhs):
   m_rows(rhs.m_rows),
   m_columns(rhs.m_columns),
-  m_pixels(rhs.m_pixels) {
+  m_pixels(rhs.m_data, rhs.m_data + rhs.arraySize()),
+  m_data(&m_pixels[0]) {
 
 }
 
 inline ALEScreen& ALEScreen::operator=(const ALEScreen &rhs) {
-  
+  if (this == &rhs)
+    return *this;
+
   m_rows = rhs.m_rows;
   m_columns = rhs.m_columns;
 
   // We rely here on the std::vector constructor doing something sensible (i.e. not wasteful)
   // inside its assignment operator
-  m_pixels = rhs.m_pixels;
+  m_pixels.assign(rhs.m_data, rhs.m_data + rhs.arraySize());
+  m_data = &m_pixels[0];
 
   return *this;
 }
 
+inline void ALEScreen::view(pixel_t *pixels) {
+  if (pixels != NULL) {
+    m_data = pixels;
+    std::vector<pixel_t>().swap(m_pixels);
+  }
+  else if (m_pixels.empty()) {
+    m_pixels.assign(m_data, m_data + arraySize());
+    m_data = &m_pixels[0];
+  }
+}
+
 inline bool ALEScreen::equals(const ALEScreen &rhs) const {
   return (m_rows == rhs.m_rows &&
           m_columns == rhs.m_columns &&
-          (memcmp(&m_pixels[0], &rhs.m_pixels[0], arraySize()) == 0) );
+          (memcmp(m_data, rhs.m_data, arraySize()) == 0) );
 }
 
 // pixel accessors, (row, column)-ordered
 inline pixel_t ALEScreen::get(int r, int c) const {
   // Perform some bounds-checking
   assert (r >= 0 && r < m_rows && c >= 0 && c < m_columns);
-  return m_pixels[r * m_columns + c];
+  return m_data[r * m_columns + c];
 }
 
 inline pixel_t* ALEScreen::pixel(int r, int c) {
   // Perform some bounds-checking
   assert (r >= 0 && r < m_rows && c >= 0 && c < m_columns);
-  return &m_pixels[r * m_columns + c];
+  return &m_data[r * m_columns + c];
 }
 
 // Access a whole row
 inline pixel_t* ALEScreen::getRow(int r) const {
   assert (r >= 0 && r < m_rows);
-  return const_cast<pixel_t*>(&m_pixels[r * m_columns]);
+  return &m_data[r * m_columns];
 }
 
 
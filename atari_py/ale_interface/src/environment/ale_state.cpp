@@ -16,13 +16,22 @@
 using namespace std;
 
 #include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+/** The stored state of states that were never saved, shared by all of them */
+static const std::shared_ptr<const std::string>& emptyState() {
+  static const std::shared_ptr<const std::string> empty(new std::string());
+  return empty;
+}
 
 /** Default constructor - loads settings from system */ 
 ALEState::ALEState():
   m_left_paddle(PADDLE_DEFAULT_VALUE),
   m_right_paddle(PADDLE_DEFAULT_VALUE),
   m_frame_number(0),
-  m_episode_frame_number(0) {
+  m_episode_frame_number(0),
+  m_serialized_state(emptyState()) {
 }
 
 ALEState::ALEState(const ALEState &rhs, std::string serialized):
@@ -30,7 +39,7 @@ ALEState::ALEState(const ALEState &rhs, std::string serialized):
   m_right_paddle(rhs.m_right_paddle),
   m_frame_number(rhs.m_frame_number),
   m_episode_frame_number(rhs.m_episode_frame_number),
-  m_serialized_state(serialized) {
+  m_serialized_state(new std::string(std::move(serialized))) {
 }
 
 ALEState::ALEState(const std::string &serialized) {
@@ -39,17 +48,108 @@ ALEState::ALEState(const std::string &serialized) {
   this->m_right_paddle = des.getInt();
   this->m_frame_number = des.getInt();
   this->m_episode_frame_number = des.getInt();
-  this->m_serialized_state = des.getString();
+  this->m_serialized_state.reset(new std::string(des.getString()));
 }
 
+// Changed bytes separated by fewer unchanged ones than this are stored as a single run, which
+// is no dearer than the header of another run: two varints, usually 3 bytes
+static const size_t DELTA_RUN_GAP = 4;
+
+ALEState::ALEState(const ALEState &rhs, const ALEState &parent):
+  m_left_paddle(rhs.m_left_paddle),
+  m_right_paddle(rhs.m_right_paddle),
+  m_frame_number(rhs.m_frame_number),
+  m_episode_frame_number(rhs.m_episode_frame_number),
+  m_keyframe(parent.keyframe()) {
+  assert(!rhs.isDelta());
+  const std::string& base = *m_keyframe;
+  const std::string& full = *rhs.m_serialized_state;
+
+  // Find the runs of bytes that differ from the keyframe
+  vector<pair<size_t, size_t> > runs;
+  size_t common = min(base.size(), full.size());
+  size_t i = 0;
+  while (i < common) {
+    if (base[i] == full[i]) {
+      i++;
+      continue;
+    }
+    size_t start = i, end = i + 1;
+    for (i = end; i < common && i < end + DELTA_RUN_GAP; i++) {
+      if (base[i] != full[i]) end = i + 1;
+    }
+    runs.push_back(make_pair(start, end - start));
+  }
+  if (full.size() > common)
+    runs.push_back(make_pair(common, full.size() - common));
+
+  // Delta format: full size, number of runs, then each run's offset, length and bytes
+  std::string delta;
+  Serializer ser(delta, true);
+  ser.putInt(full.size());
+  ser.putInt(runs.size());
+  for (size_t r = 0; r < runs.size(); r++) {
+    ser.putInt(runs[r].first);
+    ser.putInt(runs[r].second);
+    ser.putBytes(reinterpret_cast<const uInt8*>(full.data()) + runs[r].first, runs[r].second);
+  }
+
+  // Unrelated states (e.g. of another game) are better off stored in full
+  if (delta.size() >= full.size()) {
+    m_keyframe.reset();
+    m_serialized_state = rhs.m_serialized_state;
+  }
+  else {
+    m_serialized_state.reset(new std::string(std::move(delta)));
+  }
+}
+
+std::string ALEState::resolve() const {
+  if (!isDelta())
+    return *m_serialized_state;
+
+  std::string full(*m_keyframe);
+  Deserializer des(*m_serialized_state, true);
+  full.resize(des.getInt());
+  int num_runs = des.getInt();
+  for (int r = 0; r < num_runs; r++) {
+    size_t offset = des.getInt();
+    uInt32 length = des.getInt();
+    if (offset + length > full.size())
+      throw std::runtime_error("Corrupt delta ALEState");
+    des.getBytes(reinterpret_cast<uInt8*>(&full[offset]), length);
+  }
+  return full;
+}
+
+std::shared_ptr<const std::string> ALEState::keyframe() const {
+  return isDelta() ? m_keyframe : m_serialized_state;
+}
+
+
+// Compact snapshots start with this byte. Portable ones start with the 4-byte pattern written
+// by Serializer::putBool, whose first byte is never 0x01.
+static const uInt8 COMPACT_STATE_TAG = 0x01;
 
 /** Restores ALE to the given previously saved state. */ 
 void ALEState::load(OSystem* osystem, RomSettings* settings, std::string md5, const ALEState &rhs,
     bool load_system) {
-  assert(rhs.m_serialized_state.length() > 0);
+  ALE_PROFILE_SCOPE(osystem->profiler(), STATE_LOAD);
+
+  // Deltas are first applied to their keyframe
+  std::string resolved;
+  const std::string* serialized = rhs.m_serialized_state.get();
+  if (rhs.isDelta()) {
+    resolved = rhs.resolve();
+    serialized = &resolved;
+  }
+  assert(serialized->length() > 0);
   
   // Deserialize the stored string into the emulator state
-  Deserializer deser(rhs.m_serialized_state);
+  bool compact = (uInt8)(*serialized)[0] == COMPACT_STATE_TAG;
+  Deserializer deser(*serialized, compact);
+  if (compact)
+    deser.getByte();
 
   // A primitive check to produce a meaningful error if this state does not contain osystem info. 
   if (deser.getBool() != load_system)
@@ -70,9 +170,14 @@ void ALEState::load(OSystem* osystem, RomSettings* settings, std::string md5, co
 }
 
 ALEState ALEState::save(OSystem* osystem, RomSettings* settings, std::string md5, 
-    bool save_system) {
-  // Use the emulator's built-in serialization to save the state
-  Serializer ser; 
+    bool save_system, bool compact) {
+  ALE_PROFILE_SCOPE(osystem->profiler(), STATE_SAVE);
+
+  // Make a copy of this state, and serialize the emulator straight into its buffer
+  std::string serialized;
+  Serializer ser(serialized, compact);
+  if (compact)
+    ser.putByte(COMPACT_STATE_TAG);
   
   // We use 'save_system' as a check at load time. 
   ser.putBool(save_system);
@@ -82,8 +187,7 @@ ALEState ALEState::save(OSystem* osystem, RomSettings* settings, std::string md5
     osystem->saveState(ser);
   settings->saveState(ser);
 
-  // Now make a copy of this state, also storing the emulator serialization
-  return ALEState(*this, ser.get_str());
+  return ALEState(*this, std::move(serialized));
 }
 
 void ALEState::incrementFrame(int steps /* = 1 */) {
@@ -102,7 +206,11 @@ std::string ALEState::serialize() {
   ser.putInt(this->m_right_paddle);
   ser.putInt(this->m_frame_number);
   ser.putInt(this->m_episode_frame_number);
-  ser.putString(this->m_serialized_state);
+  // Serialized states are always full ones
+  if (isDelta())
+    ser.putString(resolve());
+  else
+    ser.putString(*this->m_serialized_state);
 
   return ser.get_str();
 }
@@ -479,7 +587,9 @@ void ALEState::resetKeys(Event* event) {
 }
 
 bool ALEState::equals(ALEState &rhs) {
-  return (rhs.m_serialized_state == this->m_serialized_state &&
+  bool same_state = (rhs.isDelta() || this->isDelta()) ?
+    rhs.resolve() == this->resolve() : *rhs.m_serialized_state == *this->m_serialized_state;
+  return (same_state &&
     rhs.m_left_paddle == this->m_left_paddle &&
     rhs.m_right_paddle == this->m_right_paddle &&
     rhs.m_frame_number == this->m_frame_number &&
@@ -21,6 +21,7 @@
 #include "../emucore/OSystem.hxx"
 #include "../emucore/Event.hxx"
 #include <string>
+#include <memory>
 #include "../games/RomSettings.hpp"
 #include "../common/Log.hpp"
 
@@ -41,6 +42,18 @@ class ALEState {
     // Restores a serialized ALEState
     ALEState(const std::string &serialized);
 
+    // Makes a delta copy of the full state rhs: only the bytes that differ from the keyframe
+    // of parent are stored. The keyframe is parent itself if it is a full state, or parent's
+    // own keyframe otherwise, so deltas never chain; it is shared, not copied.
+    ALEState(const ALEState &rhs, const ALEState &parent);
+
+    /** Returns true if this state is stored as a delta of a keyframe */
+    bool isDelta() const { return m_keyframe.get() != NULL; }
+
+    /** Number of bytes of emulator data held by this state (and shared with its copies), not
+      * counting a shared keyframe */
+    size_t storageSize() const { return m_serialized_state->size(); }
+
     /** Resets the system to its start state. numResetSteps 'RESET' actions are taken after the
       *  start. */
     void reset(int numResetSteps = 1);
@@ -80,8 +93,10 @@ class ALEState {
               bool load_system);
 
     /** Returns a "copy" of the current state, including the information necessary to restore
-      *  the emulator. If save_system == true, this includes the RNG state. */
-    ALEState save(OSystem* osystem, RomSettings* settings, std::string md5, bool save_system);
+      *  the emulator. If save_system == true, this includes the RNG state. If compact == true,
+      *  the emulator is saved in the compact format (see Serializer); load() accepts both. */
+    ALEState save(OSystem* osystem, RomSettings* settings, std::string md5, bool save_system,
+                  bool compact = false);
 
     /** Reset key presses */
     void resetKeys(Event* event_obj);
@@ -94,6 +109,13 @@ class ALEState {
 
     /** Calculates the Paddle resistance, based on the given x val */
     int calcPaddleResistance(int x_val);
+
+    /** Returns the full serialized emulator state, rebuilding it from the keyframe if this
+      * is a delta state. */
+    std::string resolve() const;
+
+    /** Returns the full state deltas of this state are relative to. */
+    std::shared_ptr<const std::string> keyframe() const;
   
   private:
     int m_left_paddle;   // Current value for the left-paddle
@@ -102,7 +124,11 @@ class ALEState {
     int m_frame_number; // How many frames since the start
     int m_episode_frame_number; // How many frames since the beginning of this episode
 
-    std::string m_serialized_state; // The stored environment state, if this is a saved state
+    // The stored environment state, if this is a saved state (for a delta state, the changes
+    // to m_keyframe). It never changes once stored, so copies of the state share it, and a
+    // full state's is the keyframe of its children.
+    std::shared_ptr<const std::string> m_serialized_state;
+    std::shared_ptr<const std::string> m_keyframe; // Full state a delta state is relative to
 
 };
 
@@ -0,0 +1,192 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  observation_pipeline.cpp
+ *
+ *  DQN-style observation preprocessing: grayscale conversion, max-pooling of
+ *  the last two frames, downsampling and frame stacking.
+ *
+ **************************************************************************** */
+
+#include "observation_pipeline.hpp"
+#include "../emucore/Console.hxx"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Downsampling weights are fixed point with this many fractional bits
+static const int WEIGHT_BITS = 12;
+
+/** out[i] = max(a[i], b[i]) */
+static void maxBytes(const uInt8* a, const uInt8* b, uInt8* out, size_t size) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= size; i += 16) {
+    __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_max_epu8(va, vb));
+  }
+#endif
+  for (; i < size; i++)
+    out[i] = std::max(a[i], b[i]);
+}
+
+ObservationPipeline::ObservationPipeline(OSystem * osystem, int width, int height,
+                                         int stack_size, bool max_pool):
+    m_osystem(osystem),
+    m_width(width),
+    m_height(height),
+    m_stack_size(stack_size),
+    m_max_pool(max_pool),
+    m_newest(0),
+    m_oldest(0) {
+  if (width < 1 || height < 1 || stack_size < 1)
+    throw std::invalid_argument("Observation dimensions and stack size must be positive");
+
+  MediaSource& media = m_osystem->console().mediaSource();
+  m_screen_width = media.width();
+  m_screen_height = media.height();
+
+  m_x_taps = makeTaps(m_screen_width, m_width);
+  m_y_taps = makeTaps(m_screen_height, m_height);
+
+  size_t screen_size = (size_t)m_screen_width * m_screen_height;
+  m_gray[0].assign(screen_size, 0);
+  m_gray[1].assign(screen_size, 0);
+  m_pooled.assign(screen_size, 0);
+  m_rows.assign((size_t)m_screen_height * m_width, 0);
+  m_stack.assign(observationSize(), 0);
+}
+
+std::vector<ObservationPipeline::Taps> ObservationPipeline::makeTaps(int in_size, int out_size) {
+  // Output pixel o covers source pixels [o * in_size, (o + 1) * in_size) / out_size; each
+  // source pixel contributes in proportion to its overlap with that span. Positions are
+  // scaled by out_size to keep them integral.
+  std::vector<Taps> taps(out_size);
+  for (int o = 0; o < out_size; o++) {
+    long start = (long)o * in_size, end = (long)(o + 1) * in_size;
+    int first = start / out_size;
+    int last = (end - 1) / out_size;
+
+    Taps& t = taps[o];
+    t.first = first;
+    uInt32 total = 0;
+    size_t largest = 0;
+    for (int i = first; i <= last; i++) {
+      long overlap = std::min((long)(i + 1) * out_size, end) - std::max((long)i * out_size, start);
+      uInt32 weight = (uInt32)((overlap << WEIGHT_BITS) + in_size / 2) / in_size;
+      t.weights.push_back(weight);
+      total += weight;
+      if (weight > t.weights[largest]) largest = t.weights.size() - 1;
+    }
+    // Rounding may leave the weights off by a little; they must sum to exactly one
+    t.weights[largest] += (1 << WEIGHT_BITS) - total;
+  }
+  return taps;
+}
+
+void ObservationPipeline::captureFrame(const ALEScreen& screen) {
+  ALE_PROFILE_SCOPE(m_osystem->profiler(), PALETTE);
+  m_newest ^= 1;
+  m_osystem->colourPalette().applyPaletteGrayscale(&m_gray[m_newest][0], screen.getArray(),
+                                                   m_gray[m_newest].size());
+}
+
+void ObservationPipeline::pushObservation() {
+  const uInt8* frame = &m_gray[m_newest][0];
+  if (m_max_pool) {
+    maxBytes(&m_gray[0][0], &m_gray[1][0], &m_pooled[0], m_pooled.size());
+    frame = &m_pooled[0];
+  }
+
+  // The new frame replaces the oldest one
+  resize(frame, &m_stack[(size_t)m_oldest * m_width * m_height]);
+  m_oldest = (m_oldest + 1) % m_stack_size;
+}
+
+void ObservationPipeline::reset(const ALEScreen& screen) {
+  captureFrame(screen);
+  m_gray[m_newest ^ 1] = m_gray[m_newest];
+  pushObservation();
+
+  // Fill the rest of the stack with the same frame
+  size_t frame_size = (size_t)m_width * m_height;
+  const uInt8* newest = &m_stack[(size_t)((m_oldest + m_stack_size - 1) % m_stack_size) * frame_size];
+  for (int f = 0; f < m_stack_size; f++) {
+    uInt8* dst = &m_stack[(size_t)f * frame_size];
+    if (dst != newest)
+      memcpy(dst, newest, frame_size);
+  }
+}
+
+void ObservationPipeline::copyFrames(const ObservationPipeline& pipeline) {
+  assert(pipeline.m_stack.size() == m_stack.size());
+  m_gray[0] = pipeline.m_gray[0];
+  m_gray[1] = pipeline.m_gray[1];
+  m_newest = pipeline.m_newest;
+  m_stack = pipeline.m_stack;
+  m_oldest = pipeline.m_oldest;
+}
+
+void ObservationPipeline::getObservation(uInt8* buffer) const {
+  // Unroll the ring buffer so that frames come out in chronological order
+  size_t frame_size = (size_t)m_width * m_height;
+  size_t head = (size_t)(m_stack_size - m_oldest) * frame_size;
+  memcpy(buffer, &m_stack[(size_t)m_oldest * frame_size], head);
+  memcpy(buffer + head, &m_stack[0], (size_t)m_oldest * frame_size);
+}
+
+size_t ObservationPipeline::memoryUsage() const {
+  size_t usage = sizeof(*this) + m_gray[0].capacity() + m_gray[1].capacity() +
+    m_pooled.capacity() + m_rows.capacity() * sizeof(uInt32) + m_stack.capacity();
+  const std::vector<Taps>* taps[2] = { &m_x_taps, &m_y_taps };
+  for (int axis = 0; axis < 2; axis++) {
+    usage += taps[axis]->capacity() * sizeof(Taps);
+    for (size_t i = 0; i < taps[axis]->size(); i++)
+      usage += (*taps[axis])[i].weights.capacity() * sizeof(uInt32);
+  }
+  return usage;
+}
+
+void ObservationPipeline::resize(const uInt8* src, uInt8* dst) {
+  // Horizontal pass: each source row becomes m_width weighted sums
+  for (int y = 0; y < m_screen_height; y++) {
+    const uInt8* row = src + (size_t)y * m_screen_width;
+    uInt32* out = &m_rows[(size_t)y * m_width];
+    for (int x = 0; x < m_width; x++) {
+      const Taps& t = m_x_taps[x];
+      uInt32 sum = 0;
+      for (size_t k = 0; k < t.weights.size(); k++)
+        sum += row[t.first + k] * t.weights[k];
+      out[x] = sum;
+    }
+  }
+
+  // Vertical pass over whole rows, which the compiler vectorizes
+  std::vector<uInt32> acc(m_width);
+  for (int y = 0; y < m_height; y++) {
+    const Taps& t = m_y_taps[y];
+    std::fill(acc.begin(), acc.end(), 0);
+    for (size_t k = 0; k < t.weights.size(); k++) {
+      const uInt32* row = &m_rows[(size_t)(t.first + k) * m_width];
+      uInt32 weight = t.weights[k];
+      for (int x = 0; x < m_width; x++)
+        acc[x] += row[x] * weight;
+    }
+    uInt8* out = dst + (size_t)y * m_width;
+    for (int x = 0; x < m_width; x++)
+      out[x] = (uInt8)((acc[x] + (1u << (2 * WEIGHT_BITS - 1))) >> (2 * WEIGHT_BITS));
+  }
+}
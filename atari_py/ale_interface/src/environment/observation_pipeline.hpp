@@ -0,0 +1,91 @@
+/* *****************************************************************************
+ * A.L.E (Arcade Learning Environment)
+ * Copyright (c) 2009-2013 by Yavar Naddaf, Joel Veness, Marc G. Bellemare and
+ *   the Reinforcement Learning and Artificial Intelligence Laboratory
+ * Released under the GNU General Public License; see License.txt for details.
+ *
+ * Based on: Stella  --  "An Atari 2600 VCS Emulator"
+ * Copyright (c) 1995-2007 by Bradford W. Mott and the Stella team
+ *
+ * *****************************************************************************
+ *  observation_pipeline.hpp
+ *
+ *  DQN-style observation preprocessing: grayscale conversion, max-pooling of
+ *  the last two frames, downsampling and frame stacking.
+ *
+ **************************************************************************** */
+
+#ifndef __OBSERVATION_PIPELINE_HPP__
+#define __OBSERVATION_PIPELINE_HPP__
+
+#include "../emucore/OSystem.hxx"
+#include "ale_screen.hpp"
+#include <vector>
+
+class ObservationPipeline {
+  public:
+    /** Produces stacks of stack_size frames of width x height pixels. If max_pool is
+      *  false, each frame is the last captured screen rather than the maximum of the last
+      *  two. */
+    ObservationPipeline(OSystem *, int width, int height, int stack_size, bool max_pool);
+
+    /** Converts the screen to grayscale and keeps it as the newest of the two frames
+      *  that are max-pooled. */
+    void captureFrame(const ALEScreen& screen);
+
+    /** Pools the two captured frames, downsamples the result and pushes it onto the
+      *  frame stack, dropping the oldest frame. */
+    void pushObservation();
+
+    /** Starts a new episode: every frame of the stack becomes the given screen. */
+    void reset(const ALEScreen& screen);
+
+    /** Takes on the captured frames and the frame stack of a pipeline of the same
+      *  dimensions. */
+    void copyFrames(const ObservationPipeline& pipeline);
+
+    /** Writes the frame stack, oldest frame first, as stack_size x height x width bytes. */
+    void getObservation(uInt8* buffer) const;
+
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    int stackSize() const { return m_stack_size; }
+    bool maxPool() const { return m_max_pool; }
+    size_t observationSize() const { return (size_t)m_stack_size * m_width * m_height; }
+
+    /** Returns the memory used by the pipeline, its frames and its tables. */
+    size_t memoryUsage() const;
+
+  private:
+    /** Source pixels, with weights, that make up one output pixel along an axis */
+    struct Taps {
+      int first;
+      std::vector<uInt32> weights;
+    };
+    /** Area-averaging taps for downsampling in_size pixels to out_size pixels */
+    static std::vector<Taps> makeTaps(int in_size, int out_size);
+
+    /** Downsamples a grayscale screen into the given frame of the stack */
+    void resize(const uInt8* src, uInt8* dst);
+
+  private:
+    OSystem * m_osystem;
+
+    int m_width, m_height, m_stack_size;
+    bool m_max_pool;
+    int m_screen_width, m_screen_height;
+
+    std::vector<Taps> m_x_taps, m_y_taps;
+
+    // The last two grayscale screens; m_newest indexes the most recent one
+    std::vector<uInt8> m_gray[2];
+    int m_newest;
+    std::vector<uInt8> m_pooled;
+    std::vector<uInt32> m_rows; // Horizontally downsampled rows, before the vertical pass
+
+    // Ring buffer of stack_size frames; m_oldest indexes the oldest one
+    std::vector<uInt8> m_stack;
+    int m_oldest;
+};
+
+#endif // __OBSERVATION_PIPELINE_HPP__
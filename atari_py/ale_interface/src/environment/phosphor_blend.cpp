@@ -16,79 +16,83 @@
 
 #include "phosphor_blend.hpp"
 #include "../emucore/Console.hxx"
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Taken from default Stella settings
+static const int PHOSPHOR_BLEND_RATIO = 77;
 
 PhosphorBlend::PhosphorBlend(OSystem * osystem):
     m_osystem(osystem) {
-  
-  // Taken from default Stella settings
-  m_phosphor_blend_ratio = 77;
-
-  makeAveragePalette();
+  m_blend_table = getBlendTable(m_osystem->colourPalette());
 }
 
 void PhosphorBlend::process(ALEScreen& screen) {
-  Console& console = m_osystem->console();
+  MediaSource& media = m_osystem->console().mediaSource();
 
   // Fetch current and previous frame buffers from the emulator
-  uInt8 * current_buffer  = console.mediaSource().currentFrameBuffer();
-  uInt8 * previous_buffer = console.mediaSource().previousFrameBuffer();
-
-  // Process each pixel in turn
-  for (size_t i = 0; i < screen.arraySize(); i++) { 
-    int cv = current_buffer[i];
-    int pv = previous_buffer[i];
-    
-    // Find out the corresponding rgb color 
-    uInt32 rgb = m_avg_palette[cv][pv];
+  const uInt8 * current_buffer  = media.currentFrameBuffer();
+  const uInt8 * previous_buffer = media.previousFrameBuffer();
 
-    // Set the corresponding pixel in the array
-    screen.getArray()[i] = rgbToNTSC(rgb);
-  }
+  PaletteKernels::best().lookupPair(m_blend_table->index, current_buffer, previous_buffer,
+                                    screen.getArray(), screen.arraySize());
 }
-void PhosphorBlend::makeAveragePalette() {
-  
-  ColourPalette &palette = m_osystem->colourPalette();
 
-  // Precompute the average RGB values for phosphor-averaged colors c1 and c2.
-  for (int c1 = 0; c1 < 256; c1 += 2) {
-    for (int c2 = 0; c2 < 256; c2 += 2) {
-      int r1, g1, b1;
-      int r2, g2, b2;
-      palette.getRGB(c1, r1, g1, b1);
-      palette.getRGB(c2, r2, g2, b2);
+std::shared_ptr<const PhosphorBlend::BlendTable> PhosphorBlend::getBlendTable(
+    const ColourPalette& palette) {
+  // Tables are kept for the lifetime of the process; there are only a handful of palettes
+  static std::mutex tables_mutex;
+  static std::map<std::vector<uInt32>, std::shared_ptr<const BlendTable> > tables;
 
-      uInt8 r = getPhosphor(r1, r2);
-      uInt8 g = getPhosphor(g1, g2);
-      uInt8 b = getPhosphor(b1, b2);
-      m_avg_palette[c1][c2] = makeRGB(r, g, b);
-    }
+  // Palettes are told apart by their colours
+  std::vector<uInt32> colours(256);
+  for (int c = 0; c < 256; c++) {
+    colours[c] = palette.getRGB(c);
   }
-  
-  // Also make a RGB to NTSC color map. We drop the lowest two bits to speed
-  // the initialization a little. TODO(mgbellemare): Find a better solution.
-  for (int r = 0; r < 256; r += 4) {
-    for (int g = 0; g < 256; g += 4) {  
-      for (int b = 0; b < 256; b += 4) {
-        // For each RGB point, we find its closest NTSC match
-        int minDist = 256 * 3 + 1;
-        int minIndex = -1;
 
-        // Look for the closest NTSC value matching (r,g,b). Odd palette
-        // entries correspond to grayscale values and are ignored.
-        for (int c1 = 0; c1 < 256; c1 += 2) {
-          // Get the RGB corresponding to c1
-          int r1, g1, b1;
-          palette.getRGB(c1, r1, g1, b1);
+  std::lock_guard<std::mutex> lock(tables_mutex);
+  std::shared_ptr<const BlendTable>& table = tables[colours];
+  if (!table) {
+    std::shared_ptr<BlendTable> new_table(new BlendTable());
+    makeBlendTable(palette, *new_table);
+    table = new_table;
+  }
+  return table;
+}
 
-          int dist = abs(r1 - r) + abs(g1 - g) + abs(b1 - b);
-          if (dist < minDist) {
-            minDist = dist;
-            minIndex = c1;
-          }
-        }
+void PhosphorBlend::makeBlendTable(const ColourPalette& palette, BlendTable& table) {
+  // Odd palette entries are the grayscale versions of the colours, which the TIA shows
+  // when PAL colour loss is in effect
+  int rgb[256][3];
+  for (int c = 0; c < 256; c++) {
+    uInt32 packed = palette.getRGB(c);
+    rgb[c][0] = (packed >> 16) & 0xFF;
+    rgb[c][1] = (packed >> 8) & 0xFF;
+    rgb[c][2] = packed & 0xFF;
+  }
 
-        m_rgb_ntsc[r >> 2][g >> 2][b >> 2] = minIndex;
+  // Blending is symmetric, so only half of the pairs need to be computed
+  for (int c1 = 0; c1 < 256; c1++) {
+    for (int c2 = 0; c2 <= c1; c2++) {
+      // Phosphor-average the two colours, dropping the lowest two bits of each component
+      int r = getPhosphor(rgb[c1][0], rgb[c2][0]) & ~3;
+      int g = getPhosphor(rgb[c1][1], rgb[c2][1]) & ~3;
+      int b = getPhosphor(rgb[c1][2], rgb[c2][2]) & ~3;
+
+      // Look for the closest colour to the blend; the result is never a grayscale entry
+      int minDist = 256 * 3 + 1;
+      int minIndex = -1;
+      for (int c = 0; c < 256; c += 2) {
+        int dist = abs(rgb[c][0] - r) + abs(rgb[c][1] - g) + abs(rgb[c][2] - b);
+        if (dist < minDist) {
+          minDist = dist;
+          minIndex = c;
+        }
       }
+
+      table.index[c1 * 256 + c2] = table.index[c2 * 256 + c1] = minIndex;
     }
   }
 }
@@ -100,21 +104,7 @@ uInt8 PhosphorBlend::getPhosphor(uInt8 v1, uInt8 v2) {
     v2 = tmp;
   }
 
-  uInt32 blendedValue = ((v1 - v2) * m_phosphor_blend_ratio) / 100 + v2;
+  uInt32 blendedValue = ((v1 - v2) * PHOSPHOR_BLEND_RATIO) / 100 + v2;
   if (blendedValue > 255) return 255;
   else return (uInt8) blendedValue;
 }
-
-uInt32 PhosphorBlend::makeRGB(uInt8 r, uInt8 g, uInt8 b) {
-  return (r << 16) | (g << 8) | b;
-}
-
-/** Converts a RGB value to an 8-bit format */
-uInt8 PhosphorBlend::rgbToNTSC(uInt32 rgb) {
-  int r = (rgb >> 16) & 0xFF;
-  int g = (rgb >> 8) & 0xFF;
-  int b = rgb & 0xFF;
-
-  return m_rgb_ntsc[r >> 2][g >> 2][b >> 2];
-}
-
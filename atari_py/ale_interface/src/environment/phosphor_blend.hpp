@@ -19,6 +19,8 @@
 
 #include "../emucore/OSystem.hxx"
 #include "ale_screen.hpp"
+#include "../common/PaletteKernels.hpp"
+#include <memory>
 
 class PhosphorBlend {
   public:
@@ -27,19 +29,22 @@ class PhosphorBlend {
     void process(ALEScreen& screen);
 
   private:
-    void makeAveragePalette();
-    uInt8 getPhosphor(uInt8 v1, uInt8 v2);
-    uInt32 makeRGB(uInt8 r, uInt8 g, uInt8 b);
-    /** Converts a RGB value to an 8-bit format */
-    uInt8 rgbToNTSC(uInt32 rgb);
+    /** The blended colour for each pair of palette indices, indexed by
+      * current * 256 + previous. */
+    struct BlendTable {
+      uInt8 index[256 * 256 + PaletteKernels::PAIR_TABLE_PADDING];
+    };
+
+    /** Returns the blend table for the given palette. Tables are built once per palette
+      * and shared, read-only, by all instances. */
+    static std::shared_ptr<const BlendTable> getBlendTable(const ColourPalette& palette);
+    static void makeBlendTable(const ColourPalette& palette, BlendTable& table);
+    static uInt8 getPhosphor(uInt8 v1, uInt8 v2);
     
   private:
     OSystem * m_osystem;
 
-    uInt8 m_rgb_ntsc[64][64][64];
-
-    uInt32 m_avg_palette[256][256];
-    uInt8 m_phosphor_blend_ratio;
+    std::shared_ptr<const BlendTable> m_blend_table;
 };
 
 #endif // __PHOSPHOR_BLEND_HPP__
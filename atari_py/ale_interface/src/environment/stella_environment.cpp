@@ -18,13 +18,16 @@
 #include "stella_environment.hpp"
 #include "../emucore/m6502/src/System.hxx"
 #include <sstream>
+#include <cstring>
+#include <set>
 
 StellaEnvironment::StellaEnvironment(OSystem* osystem, RomSettings* settings):
   m_osystem(osystem),
   m_settings(settings),
-  m_phosphor_blend(osystem),  
   m_screen(m_osystem->console().mediaSource().height(),
         m_osystem->console().mediaSource().width()),
+  m_screen_dirty(true),
+  m_ram_dirty(true),
   m_player_a_action(PLAYER_A_NOOP),
   m_player_b_action(PLAYER_B_NOOP) {
 
@@ -39,12 +42,26 @@ StellaEnvironment::StellaEnvironment(OSystem* osystem, RomSettings* settings):
   m_num_reset_steps = 4;
   m_cartridge_md5 = m_osystem->console().properties().get(Cartridge_MD5);
   
-  m_max_num_frames_per_episode = m_osystem->settings().getInt("max_num_frames_per_episode");
-  m_colour_averaging = m_osystem->settings().getBool("color_averaging");
+  m_max_num_frames_per_episode = m_osystem->settings().maxNumFramesPerEpisode();
+  m_colour_averaging = m_osystem->settings().colorAveraging();
 
-  m_repeat_action_probability = m_osystem->settings().getFloat("repeat_action_probability");
+  m_repeat_action_probability = m_osystem->settings().repeatActionProbability();
+
+  m_use_reset_cache = m_osystem->settings().getBool("reset_cache");
+
+  m_compact_state = m_osystem->settings().getBool("compact_state");
+
+  m_render_skip = m_osystem->settings().getBool("render_skip");
+
+  // Without colour averaging the screen is the frame buffer as is, and can just show it
+  m_compact_memory = m_osystem->settings().getBool("compact_memory") && !m_colour_averaging;
+  if (m_compact_memory)
+    m_screen.view(m_osystem->console().mediaSource().currentFrameBuffer());
+
+  if (m_colour_averaging)
+    m_phosphor_blend.reset(new PhosphorBlend(m_osystem));
   
-  m_frame_skip = m_osystem->settings().getInt("frame_skip");
+  m_frame_skip = m_osystem->settings().frameSkip();
   if (m_frame_skip < 1) {
     ale::Logger::Warning << "Warning: frame skip set to < 1. Setting to 1." << std::endl;
     m_frame_skip = 1;
@@ -58,6 +75,43 @@ StellaEnvironment::StellaEnvironment(OSystem* osystem, RomSettings* settings):
     // Create the screen exporter
     m_screen_exporter.reset(new ScreenExporter(m_osystem->colourPalette(), recordDir)); 
   }
+
+  if (m_osystem->settings().getBool("preprocess_observations")) {
+    m_observation_pipeline.reset(new ObservationPipeline(m_osystem,
+      m_osystem->settings().getInt("observation_width"),
+      m_osystem->settings().getInt("observation_height"),
+      m_osystem->settings().getInt("observation_stack"),
+      m_osystem->settings().getBool("observation_max_pool")));
+  }
+}
+
+StellaEnvironment* StellaEnvironment::clone(OSystem* osystem, RomSettings* settings) {
+  std::unique_ptr<StellaEnvironment> environment(new StellaEnvironment(osystem, settings));
+
+  // The emulator, including the RNG, then what its saved state leaves out
+  environment->restoreSystemState(cloneSystemState());
+  osystem->console().mediaSource().copyFrameState(m_osystem->console().mediaSource());
+  for (int type = 0; type < Event::LastType; type++) {
+    osystem->event()->set((Event::Type)type, m_osystem->event()->get((Event::Type)type));
+  }
+
+  environment->m_saved_states = m_saved_states;
+  // A screen that views the frame buffer views the clone's copy of it once processed
+  if (!m_compact_memory)
+    environment->m_screen = m_screen;
+  environment->m_ram = m_ram;
+  environment->m_screen_dirty = m_screen_dirty || m_compact_memory;
+  environment->m_ram_dirty = m_ram_dirty;
+  environment->m_player_a_action = m_player_a_action;
+  environment->m_player_b_action = m_player_b_action;
+  environment->m_use_reset_cache = m_use_reset_cache;
+  // Snapshots are immutable, so the clone shares them
+  environment->m_reset_cache = m_reset_cache;
+
+  if (m_observation_pipeline.get() != NULL)
+    environment->m_observation_pipeline->copyFrames(*m_observation_pipeline);
+
+  return environment.release();
 }
 
 /** Resets the system to its start state. */
@@ -69,6 +123,25 @@ void StellaEnvironment::reset() {
   // Reset the emulator
   m_osystem->console().system().reset();
 
+  // The rest of the reset only depends on the RIOT's random start timer: restore the
+  // result of an earlier reset with the same timer, if we have one. A frame left
+  // unfinished by the previous episode carries over, so that case is always emulated.
+  // The snapshots leave the RNG alone, which is only exact if the emulated reset draws
+  // no random numbers; that is checked whenever a reset is emulated.
+  MediaSource& media = m_osystem->console().mediaSource();
+  uInt32 timer = m_osystem->console().riot().timer();
+  bool use_cache = m_use_reset_cache && !media.partialFrame();
+  if (use_cache && restoreResetSnapshot(timer)) {
+    if (m_observation_pipeline.get() != NULL)
+      m_observation_pipeline->reset(getScreen());
+    return;
+  }
+  std::string rng_state;
+  if (use_cache) {
+    Serializer ser(rng_state);
+    m_osystem->rng().saveState(ser);
+  }
+
   // NOOP for 60 steps in the deterministic environment setting, or some random amount otherwise 
   int noopSteps;
   noopSteps = 60;
@@ -85,38 +158,125 @@ void StellaEnvironment::reset() {
   for (size_t i = 0; i < startingActions.size(); i++){
     emulate(startingActions[i], PLAYER_B_NOOP);
   }
+
+  if (use_cache && !media.partialFrame()) {
+    std::string rng_after;
+    Serializer ser(rng_after);
+    m_osystem->rng().saveState(ser);
+    if (rng_after == rng_state) {
+      saveResetSnapshot(timer);
+    } else {
+      ale::Logger::Warning << "Resets of this game draw random numbers; "
+                           << "disabling the reset cache" << std::endl;
+      m_use_reset_cache = false;
+      m_reset_cache.clear();
+    }
+  }
+
+  if (m_observation_pipeline.get() != NULL)
+    m_observation_pipeline->reset(getScreen());
+}
+
+bool StellaEnvironment::ResetSnapshot::sameAs(const ResetSnapshot& other) const {
+  return *state.m_serialized_state == *other.state.m_serialized_state &&
+    current_frame == other.current_frame &&
+    previous_frame == other.previous_frame;
+}
+
+bool StellaEnvironment::restoreResetSnapshot(uInt32 timer) {
+  std::map<uInt32, CachedReset>::const_iterator it = m_reset_cache.find(timer);
+  if (it == m_reset_cache.end() || !it->second.verified)
+    return false;
+  const ResetSnapshot& snapshot = *it->second.snapshot;
+
+  // The total frame count is not affected by resets
+  int frame_number = m_state.getFrameNumber();
+  restoreState(snapshot.state);
+  m_state.m_frame_number = frame_number;
+
+  MediaSource& media = m_osystem->console().mediaSource();
+  memcpy(media.currentFrameBuffer(), &snapshot.current_frame[0], snapshot.current_frame.size());
+  memcpy(media.previousFrameBuffer(), &snapshot.previous_frame[0], snapshot.previous_frame.size());
+
+  m_screen_dirty = true;
+  return true;
+}
+
+void StellaEnvironment::saveResetSnapshot(uInt32 timer) {
+  std::shared_ptr<ResetSnapshot> snapshot(new ResetSnapshot());
+  snapshot->state = cloneState();
+
+  MediaSource& media = m_osystem->console().mediaSource();
+  size_t frame_size = media.width() * media.height();
+  snapshot->current_frame.assign(media.currentFrameBuffer(),
+                                 media.currentFrameBuffer() + frame_size);
+  snapshot->previous_frame.assign(media.previousFrameBuffer(),
+                                  media.previousFrameBuffer() + frame_size);
+
+  std::map<uInt32, CachedReset>::iterator cached = m_reset_cache.find(timer);
+  if (cached != m_reset_cache.end()) {
+    if (!snapshot->sameAs(*cached->second.snapshot)) {
+      ale::Logger::Warning << "Resets of this game depend on the previous episode; "
+                           << "disabling the reset cache" << std::endl;
+      m_use_reset_cache = false;
+      m_reset_cache.clear();
+      return;
+    }
+    cached->second.verified = true;
+    return;
+  }
+
+  CachedReset entry;
+  entry.snapshot = snapshot;
+  entry.verified = false;
+
+  // Many start timers lead to the same post-reset state; share those snapshots
+  std::map<uInt32, CachedReset>::const_iterator it;
+  for (it = m_reset_cache.begin(); it != m_reset_cache.end(); ++it) {
+    if (it->second.snapshot->sameAs(*snapshot)) {
+      entry.snapshot = it->second.snapshot;
+      break;
+    }
+  }
+  m_reset_cache[timer] = entry;
 }
 
 /** Save/restore the environment state. */
 void StellaEnvironment::save() {
   // Store the current state into a new object
   ALEState new_state = cloneState();
-  m_saved_states.push(new_state);
+  m_saved_states.push_back(new_state);
 }
 
 void StellaEnvironment::load() {
   // Get the state on top of the stack
-  ALEState& target_state = m_saved_states.top(); 
+  ALEState& target_state = m_saved_states.back(); 
  
   // Deserialize it into 'm_state'
   restoreState(target_state);
-  m_saved_states.pop();
+  m_saved_states.pop_back();
 }
 
 ALEState StellaEnvironment::cloneState() {
-  return m_state.save(m_osystem, m_settings, m_cartridge_md5, false);
+  return m_state.save(m_osystem, m_settings, m_cartridge_md5, false, m_compact_state);
+}
+
+ALEState StellaEnvironment::cloneState(const ALEState& parent) {
+  return ALEState(cloneState(), parent);
 }
 
 void StellaEnvironment::restoreState(const ALEState& target_state) {
   m_state.load(m_osystem, m_settings, m_cartridge_md5, target_state, false);
+  m_ram_dirty = true;
 }
 
 ALEState StellaEnvironment::cloneSystemState() {
-  return m_state.save(m_osystem, m_settings, m_cartridge_md5, true);
+  return m_state.save(m_osystem, m_settings, m_cartridge_md5, true, m_compact_state);
 }
 
 void StellaEnvironment::restoreSystemState(const ALEState& target_state) {
   m_state.load(m_osystem, m_settings, m_cartridge_md5, target_state, true);
+  m_ram_dirty = true;
 }
 
 void StellaEnvironment::noopIllegalActions(Action & player_a_action, Action & player_b_action) {
@@ -142,6 +302,27 @@ reward_t StellaEnvironment::act(Action player_a_action, Action player_b_action)
   reward_t sum_rewards = 0;
 
   Random& rng = m_osystem->rng();
+  MediaSource& media = m_osystem->console().mediaSource();
+
+  // With render skipping, only the frames that make up the final screen and observation
+  // are drawn: the last one, one more if colour averaging blends it with its predecessor,
+  // and one more if the observation pipeline max-pools the last two screens. Should the
+  // episode end before the last frame, the act is replayed from its start state.
+  size_t first_drawn = 0;
+  ALEState start;
+  if (m_render_skip && m_screen_exporter.get() == NULL && !isTerminal()) {
+    size_t drawn = 1;
+    if (m_colour_averaging)
+      drawn++;
+    if (m_observation_pipeline.get() != NULL && m_observation_pipeline->maxPool())
+      drawn++;
+    if (m_frame_skip > drawn) {
+      first_drawn = m_frame_skip - drawn;
+      start = m_state.save(m_osystem, m_settings, m_cartridge_md5, false, true);
+      m_act_actions.clear();
+      media.enableRendering(false);
+    }
+  }
 
   // Apply the same action for a given number of times... note that act() will refuse to emulate 
   //  past the terminal state
@@ -154,21 +335,51 @@ reward_t StellaEnvironment::act(Action player_a_action, Action player_b_action)
     if (rng.nextDouble() >= m_repeat_action_probability)
       m_player_b_action = player_b_action;
 
+    if (i == first_drawn)
+      media.enableRendering(true);
+
     // If so desired, request one frame's worth of sound (this does nothing if recording
     // is not enabled)
     m_osystem->sound().recordNextFrame();
 
     // Similarly record screen as needed
     if (m_screen_exporter.get() != NULL)
-        m_screen_exporter->saveNext(m_screen);
+        m_screen_exporter->saveNext(getScreen());
 
     // Use the stored actions, which may or may not have changed this frame
     sum_rewards += oneStepAct(m_player_a_action, m_player_b_action);
+
+    // An episode that ends early has its final screen made of frames that may not have
+    // been drawn
+    if (first_drawn > 0 && i + 1 < m_frame_skip) {
+      m_act_actions.push_back(std::make_pair(m_player_a_action, m_player_b_action));
+      if (isTerminal()) {
+        replayFrames(start, m_act_actions);
+        first_drawn = 0;
+      }
+    }
+
+    // The pipeline pools the last two frames of the frame skip
+    if (m_observation_pipeline.get() != NULL && i + 2 >= m_frame_skip)
+      m_observation_pipeline->captureFrame(getScreen());
   }
 
+  if (m_observation_pipeline.get() != NULL)
+    m_observation_pipeline->pushObservation();
+
   return sum_rewards;
 }
 
+void StellaEnvironment::replayFrames(const ALEState& start,
+                                     const std::vector<std::pair<Action, Action> >& actions) {
+  // Frames that weren't drawn left the frame buffers untouched, so they still hold the
+  // screens from before the act. The rewards were already counted the first time round.
+  restoreState(start);
+  m_osystem->console().mediaSource().enableRendering(true);
+  for (size_t i = 0; i < actions.size(); i++)
+    oneStepAct(actions[i].first, actions[i].second);
+}
+
 /** Applies the given actions (e.g. updating paddle positions when the paddle is used)
   *  and performs one simulation step in Stella. */
 reward_t StellaEnvironment::oneStepAct(Action player_a_action, Action player_b_action) {
@@ -206,6 +417,7 @@ void StellaEnvironment::emulate(Action player_a_action, Action player_b_action,
       m_state.applyActionPaddles(event, player_a_action, player_b_action);
 
       m_osystem->console().mediaSource().update();
+      ALE_PROFILE_SCOPE(m_osystem->profiler(), ROM_STEP);
       m_settings->step(m_osystem->console().system());
     }
   }
@@ -215,13 +427,14 @@ void StellaEnvironment::emulate(Action player_a_action, Action player_b_action,
 
     for (size_t t = 0; t < num_steps; t++) {
       m_osystem->console().mediaSource().update();
+      ALE_PROFILE_SCOPE(m_osystem->profiler(), ROM_STEP);
       m_settings->step(m_osystem->console().system());
     }
   }
+  ALE_PROFILE_COUNT(m_osystem->profiler(), FRAMES, num_steps);
 
-  // Parse screen and RAM into their respective data structures
-  processScreen();
-  processRAM();
+  // Screen and RAM are parsed into their respective data structures when asked for
+  m_screen_dirty = m_ram_dirty = true;
 }
 
 /** Accessor methods for the environment state. */
@@ -233,10 +446,31 @@ const ALEState& StellaEnvironment::getState() const {
   return m_state;
 }
 
+const ALEScreen& StellaEnvironment::getScreen() {
+  if (m_screen_dirty) {
+    processScreen();
+    m_screen_dirty = false;
+  }
+  return m_screen;
+}
+
+const ALERAM& StellaEnvironment::getRAM() {
+  if (m_ram_dirty) {
+    processRAM();
+    m_ram_dirty = false;
+  }
+  return m_ram;
+}
+
 void StellaEnvironment::processScreen() {
+  ALE_PROFILE_SCOPE(m_osystem->profiler(), PROCESS_SCREEN);
   if (m_colour_averaging) {
     // Perform phosphor averaging; the blender stores its result in the given screen
-    m_phosphor_blend.process(m_screen);
+    m_phosphor_blend->process(m_screen);
+  }
+  else if (m_compact_memory) {
+    // The TIA swaps its frame buffers, so look at whichever is current now
+    m_screen.view(m_osystem->console().mediaSource().currentFrameBuffer());
   }
   else {
     // Copy screen over and we're done! 
@@ -245,9 +479,42 @@ void StellaEnvironment::processScreen() {
   }
 }
 
+size_t StellaEnvironment::memoryUsage() const {
+  size_t usage = sizeof(*this) + m_screen.memoryUsage() + m_cartridge_md5.capacity() +
+    m_act_actions.capacity() * sizeof(m_act_actions[0]);
+  if (m_phosphor_blend.get() != NULL)
+    usage += sizeof(PhosphorBlend);
+  if (m_screen_exporter.get() != NULL)
+    usage += sizeof(ScreenExporter);
+  if (m_observation_pipeline.get() != NULL)
+    usage += m_observation_pipeline->memoryUsage();
+  return usage;
+}
+
+size_t StellaEnvironment::savedStateUsage() const {
+  size_t usage = m_saved_states.capacity() * sizeof(ALEState);
+  for (size_t i = 0; i < m_saved_states.size(); i++)
+    usage += m_saved_states[i].storageSize();
+
+  // Count snapshots shared between start values once
+  std::set<const ResetSnapshot*> counted;
+  std::map<uInt32, CachedReset>::const_iterator it;
+  for (it = m_reset_cache.begin(); it != m_reset_cache.end(); ++it) {
+    // A map node: the key and entry, plus the links and colour of the tree.
+    // The node type is private to the library, so this is an estimate
+    usage += sizeof(*it) + 4 * sizeof(void*);
+    const ResetSnapshot* snapshot = it->second.snapshot.get();
+    if (counted.insert(snapshot).second) {
+      usage += sizeof(ResetSnapshot) + snapshot->state.storageSize() +
+        snapshot->current_frame.capacity() + snapshot->previous_frame.capacity();
+    }
+  }
+  return usage;
+}
+
 void StellaEnvironment::processRAM() {
+  ALE_PROFILE_SCOPE(m_osystem->profiler(), PROCESS_RAM);
   // Copy RAM over
-  for (size_t i = 0; i < m_ram.size(); i++)
-    *m_ram.byte(i) = m_osystem->console().system().peek(i + 0x80); 
+  memcpy(m_ram.array(), m_osystem->console().system().ram(), m_ram.size());
 }
 
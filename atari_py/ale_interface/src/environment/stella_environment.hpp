@@ -22,13 +22,16 @@
 #include "ale_screen.hpp"
 #include "ale_ram.hpp"
 #include "phosphor_blend.hpp"
+#include "observation_pipeline.hpp"
 #include "../emucore/OSystem.hxx"
 #include "../emucore/Event.hxx"
 #include "../games/RomSettings.hpp"
 #include "../common/ScreenExporter.hpp"
 #include "../common/Log.hpp"
 
-#include <stack>
+#include <map>
+#include <memory>
+#include <vector>
 
 // This defines the number of "random" environments
 #define NUM_RANDOM_ENVIRONMENTS (500)
@@ -37,6 +40,11 @@ class StellaEnvironment {
   public:
     StellaEnvironment(OSystem * system, RomSettings * settings);
 
+    /** Returns a new environment on the given system, whose console must play the same
+      *  cartridge, in the same state as this one: emulator, RNG, saved states, screen,
+      *  observation frames and reset cache are all copied. */
+    StellaEnvironment *clone(OSystem * system, RomSettings * settings);
+
     /** Resets the system to its start state. */
     void reset();
 
@@ -47,6 +55,8 @@ class StellaEnvironment {
     /** Returns a copy of the current emulator state. Note that this doesn't include
         pseudorandomness, so that clone/restoreState are suitable for planning. */
     ALEState cloneState();
+    /** Like cloneState(), but stores the copy as a delta of parent (see ALEState). */
+    ALEState cloneState(const ALEState& parent);
     /** Restores a previously saved copy of the state. */
     void restoreState(const ALEState&);
 
@@ -71,13 +81,26 @@ class StellaEnvironment {
     void setState(const ALEState & state);
     const ALEState &getState() const;
 
-    /** Returns the current screen after processing (e.g. colour averaging) */
-    const ALEScreen &getScreen() const { return m_screen; }
-    const ALERAM &getRAM() const { return m_ram; }
+    /** Returns the current screen after processing (e.g. colour averaging). The screen and
+      *  RAM are only processed when first asked for after emulating. With compact_memory
+      *  (and no colour averaging) the screen shows the emulator's frame buffer rather than
+      *  a copy of it, so its pixels are only valid until the emulator moves on. */
+    const ALEScreen &getScreen();
+    const ALERAM &getRAM();
+
+    /** Returns the observation pipeline, or NULL if preprocess_observations is off. Its
+      *  frame stack is not part of ALEState; restoring a state leaves it untouched. */
+    const ObservationPipeline *getObservationPipeline() const { return m_observation_pipeline.get(); }
 
     int getFrameNumber() const { return m_state.getFrameNumber(); }
     int getEpisodeFrameNumber() const { return m_state.getEpisodeFrameNumber(); }
 
+    /** Returns the memory used by the environment, not counting its saved states. */
+    size_t memoryUsage() const;
+    /** Returns the memory used by the saved states and the reset cache. Snapshots of the
+      *  reset cache are shared with clones, and counted by each of them. */
+    size_t savedStateUsage() const;
+
   private:
     /** This applies an action exactly one time step. Helper function to act(). */
     reward_t oneStepAct(Action player_a_action, Action player_b_action);
@@ -94,17 +117,29 @@ class StellaEnvironment {
     /** Processes the emulator RAM and saves it in m_ram */
     void processRAM();
 
+    /** Restores the state an act() started from and emulates the given frames again, this
+      *  time drawing them. */
+    void replayFrames(const ALEState& start, const std::vector<std::pair<Action, Action> >& actions);
+
+    /** Restores the cached post-reset state for the given RIOT start timer, if there is
+      *  a verified one. Returns false if the reset still has to be emulated. */
+    bool restoreResetSnapshot(uInt32 timer);
+    /** Caches the current (just reset) state under the given RIOT start timer, or checks
+      *  it against the state already cached there. */
+    void saveResetSnapshot(uInt32 timer);
+
   private:
     OSystem *m_osystem;
     RomSettings *m_settings;
-    PhosphorBlend m_phosphor_blend; // For performing phosphor colour averaging, if so desired
+    std::unique_ptr<PhosphorBlend> m_phosphor_blend; // For performing phosphor colour averaging, if so desired
     std::string m_cartridge_md5; // Necessary for saving and loading emulator state
 
-    std::stack<ALEState> m_saved_states; // States are saved on a stack
+    std::vector<ALEState> m_saved_states; // States are saved on a stack
     
     ALEState m_state; // Current environment state    
     ALEScreen m_screen; // The current ALE screen (possibly colour-averaged)
     ALERAM m_ram; // The current ALE RAM
+    bool m_screen_dirty, m_ram_dirty; // Whether the emulator has moved on since they were processed
 
     bool m_use_paddles;  // Whether this game uses paddles
     
@@ -114,10 +149,41 @@ class StellaEnvironment {
     int m_max_num_frames_per_episode; // Maxmimum number of frames per episode 
     size_t m_frame_skip; // How many frames to emulate per act()
     float m_repeat_action_probability; // Stochasticity of the environment
+    bool m_compact_state; // Whether to clone states in the compact format
+    bool m_render_skip; // Whether to skip drawing frames that act() doesn't observe
+    bool m_compact_memory; // Whether the screen views the frame buffer instead of copying it
     std::auto_ptr<ScreenExporter> m_screen_exporter; // Automatic screen recorder
+    std::unique_ptr<ObservationPipeline> m_observation_pipeline; // DQN-style preprocessing
 
     // The last actions taken by our players
     Action m_player_a_action, m_player_b_action;
+    // Actions of the frames of the current act(), in case they have to be replayed
+    std::vector<std::pair<Action, Action> > m_act_actions;
+
+    /** Reset cache. Besides the game, the only input of a full reset is the random
+      * value the RIOT timer starts with, provided the game initializes its memory on
+      * boot and the TIA is between frames. The post-reset state is therefore cached per
+      * start value. Resets that start or end in the middle of a frame (the partial frame
+      * is not part of ALEState) bypass the cache. The TIA frame
+      * buffers are not part of ALEState; they are kept alongside to reproduce the
+      * post-reset screen and colour averaging. */
+    struct ResetSnapshot {
+      ALEState state;
+      std::vector<uInt8> current_frame;
+      std::vector<uInt8> previous_frame;
+
+      bool sameAs(const ResetSnapshot& other) const;
+    };
+    /** A snapshot is only used once a second full reset with the same start value
+      * reproduced it; otherwise the game keeps state across resets (e.g. a high score
+      * in cartridge RAM) and the cache turns itself off. Identical snapshots are shared
+      * between start values. */
+    struct CachedReset {
+      std::shared_ptr<const ResetSnapshot> snapshot;
+      bool verified;
+    };
+    bool m_use_reset_cache;
+    std::map<uInt32, CachedReset> m_reset_cache;
 };
 
 #endif // __STELLA_ENVIRONMENT_HPP__
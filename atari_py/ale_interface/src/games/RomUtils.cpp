@@ -22,11 +22,8 @@
 /* reads a byte at a memory location between 0 and 128 */
 int readRam(const System* system, int offset) {
 
-    // peek modifies data-bus state, but is logically const from
-    // the point of view of the RL interface
-    System* sys = const_cast<System*>(system);
-
-    return sys->peek((offset & 0x7F) + 0x80);
+    // Read the RAM directly rather than through the bus, which peek would update
+    return system->ram()[offset & 0x7F];
 }
 
 
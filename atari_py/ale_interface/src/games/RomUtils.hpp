@@ -19,7 +19,7 @@
 
 class System;
 
-// reads a byte at a memory location between 0 and 1023
+// reads a byte at a memory location between 0 and 127
 extern int readRam(const System* system, int offset);
 
 // extracts a decimal value from 1, 2, and 3 bytes respectively
@@ -2,13 +2,15 @@
 # Author: Ben Goodrich
 # This directly implements a python version of the arcade learning
 # environment interface.
-__all__ = ['ALEInterface']
+__all__ = ['ALEInterface', 'ALEVectorInterface']
 
 from ctypes import *
 import numpy as np
-from numpy.ctypeslib import as_ctypes
+from numpy.ctypeslib import as_ctypes, as_array
 import os
+import json
 import six
+from collections import namedtuple
 
 ale_lib = cdll.LoadLibrary(os.path.join(os.path.dirname(__file__),
                                         'ale_interface/build/libale_c.so'))
@@ -17,6 +19,22 @@ ale_lib.ALE_new.argtypes = None
 ale_lib.ALE_new.restype = c_void_p
 ale_lib.ALE_del.argtypes = [c_void_p]
 ale_lib.ALE_del.restype = None
+ale_lib.ALE_clone.argtypes = [c_void_p]
+ale_lib.ALE_clone.restype = c_void_p
+ale_lib.ALEConfig_new.argtypes = None
+ale_lib.ALEConfig_new.restype = c_void_p
+ale_lib.ALEConfig_del.argtypes = [c_void_p]
+ale_lib.ALEConfig_del.restype = None
+ale_lib.ALEConfig_setString.argtypes = [c_void_p, c_char_p, c_char_p]
+ale_lib.ALEConfig_setString.restype = None
+ale_lib.ALEConfig_setInt.argtypes = [c_void_p, c_char_p, c_int]
+ale_lib.ALEConfig_setInt.restype = None
+ale_lib.ALEConfig_setBool.argtypes = [c_void_p, c_char_p, c_bool]
+ale_lib.ALEConfig_setBool.restype = None
+ale_lib.ALEConfig_setFloat.argtypes = [c_void_p, c_char_p, c_float]
+ale_lib.ALEConfig_setFloat.restype = None
+ale_lib.ALE_newFromMemory.argtypes = [c_void_p, c_char_p, c_size_t, c_char_p]
+ale_lib.ALE_newFromMemory.restype = c_void_p
 ale_lib.getString.argtypes = [c_void_p, c_char_p]
 ale_lib.getString.restype = c_char_p
 ale_lib.getInt.argtypes = [c_void_p, c_char_p]
@@ -61,6 +79,14 @@ ale_lib.getRAM.argtypes = [c_void_p, c_void_p]
 ale_lib.getRAM.restype = None
 ale_lib.getRAMSize.argtypes = [c_void_p]
 ale_lib.getRAMSize.restype = c_int
+ale_lib.getRAMView.argtypes = [c_void_p]
+ale_lib.getRAMView.restype = c_void_p
+ale_lib.getProfileJSON.argtypes = [c_void_p]
+ale_lib.getProfileJSON.restype = c_char_p
+ale_lib.resetProfile.argtypes = [c_void_p]
+ale_lib.resetProfile.restype = None
+ale_lib.getMemoryUsageJSON.argtypes = [c_void_p]
+ale_lib.getMemoryUsageJSON.restype = c_char_p
 ale_lib.getScreenWidth.argtypes = [c_void_p]
 ale_lib.getScreenWidth.restype = c_int
 ale_lib.getScreenHeight.argtypes = [c_void_p]
@@ -69,14 +95,26 @@ ale_lib.getScreenRGB.argtypes = [c_void_p, c_void_p]
 ale_lib.getScreenRGB.restype = None
 ale_lib.getScreenRGB2.argtypes = [c_void_p, c_void_p]
 ale_lib.getScreenRGB2.restype = None
+ale_lib.getScreenRGBA.argtypes = [c_void_p, c_void_p]
+ale_lib.getScreenRGBA.restype = None
+ale_lib.getScreenCHW.argtypes = [c_void_p, c_void_p]
+ale_lib.getScreenCHW.restype = None
 ale_lib.getScreenGrayscale.argtypes = [c_void_p, c_void_p]
 ale_lib.getScreenGrayscale.restype = None
+ale_lib.getObservation.argtypes = [c_void_p, c_void_p]
+ale_lib.getObservation.restype = None
+ale_lib.getObservationSize.argtypes = [c_void_p]
+ale_lib.getObservationSize.restype = c_int
+ale_lib.step.argtypes = [c_void_p, c_int, c_void_p, c_int, c_void_p, c_void_p]
+ale_lib.step.restype = None
 ale_lib.saveState.argtypes = [c_void_p]
 ale_lib.saveState.restype = None
 ale_lib.loadState.argtypes = [c_void_p]
 ale_lib.loadState.restype = None
 ale_lib.cloneState.argtypes = [c_void_p]
 ale_lib.cloneState.restype = c_void_p
+ale_lib.cloneDeltaState.argtypes = [c_void_p, c_void_p]
+ale_lib.cloneDeltaState.restype = c_void_p
 ale_lib.restoreState.argtypes = [c_void_p, c_void_p]
 ale_lib.restoreState.restype = None
 ale_lib.cloneSystemState.argtypes = [c_void_p]
@@ -95,12 +133,74 @@ ale_lib.decodeState.argtypes = [c_void_p, c_int]
 ale_lib.decodeState.restype = c_void_p
 ale_lib.setLoggerMode.argtypes = [c_int]
 ale_lib.setLoggerMode.restype = None
+ale_lib.ALEVector_new.argtypes = [c_int, c_int]
+ale_lib.ALEVector_new.restype = c_void_p
+ale_lib.ALEVector_del.argtypes = [c_void_p]
+ale_lib.ALEVector_del.restype = None
+ale_lib.ALEVector_size.argtypes = [c_void_p]
+ale_lib.ALEVector_size.restype = c_int
+ale_lib.ALEVector_numThreads.argtypes = [c_void_p]
+ale_lib.ALEVector_numThreads.restype = c_int
+ale_lib.ALEVector_setString.argtypes = [c_void_p, c_char_p, c_char_p]
+ale_lib.ALEVector_setString.restype = None
+ale_lib.ALEVector_setInt.argtypes = [c_void_p, c_char_p, c_int]
+ale_lib.ALEVector_setInt.restype = None
+ale_lib.ALEVector_setBool.argtypes = [c_void_p, c_char_p, c_bool]
+ale_lib.ALEVector_setBool.restype = None
+ale_lib.ALEVector_setFloat.argtypes = [c_void_p, c_char_p, c_float]
+ale_lib.ALEVector_setFloat.restype = None
+ale_lib.ALEVector_loadROM.argtypes = [c_void_p, c_char_p]
+ale_lib.ALEVector_loadROM.restype = c_int
+ale_lib.ALEVector_act_batch.argtypes = [c_void_p, c_void_p, c_void_p, c_void_p, c_void_p]
+ale_lib.ALEVector_act_batch.restype = c_int
+ale_lib.ALEVector_reset_all.argtypes = [c_void_p, c_void_p]
+ale_lib.ALEVector_reset_all.restype = c_int
+ale_lib.ALEVector_getScreens.argtypes = [c_void_p, c_void_p]
+ale_lib.ALEVector_getScreens.restype = None
+ale_lib.ALEVector_send.argtypes = [c_void_p, c_void_p, c_void_p, c_int]
+ale_lib.ALEVector_send.restype = c_int
+ale_lib.ALEVector_recv.argtypes = [c_void_p, c_int]
+ale_lib.ALEVector_recv.restype = c_int
+ale_lib.ALEVector_slabEnvIds.argtypes = [c_void_p, c_int]
+ale_lib.ALEVector_slabEnvIds.restype = POINTER(c_int)
+ale_lib.ALEVector_slabRewards.argtypes = [c_void_p, c_int]
+ale_lib.ALEVector_slabRewards.restype = POINTER(c_int)
+ale_lib.ALEVector_slabTerminals.argtypes = [c_void_p, c_int]
+ale_lib.ALEVector_slabTerminals.restype = POINTER(c_bool)
+ale_lib.ALEVector_slabScreens.argtypes = [c_void_p, c_int]
+ale_lib.ALEVector_slabScreens.restype = POINTER(c_ubyte)
+ale_lib.ALEVector_getScreenWidth.argtypes = [c_void_p]
+ale_lib.ALEVector_getScreenWidth.restype = c_int
+ale_lib.ALEVector_getScreenHeight.argtypes = [c_void_p]
+ale_lib.ALEVector_getScreenHeight.restype = c_int
+ale_lib.ALEVector_getMinimalActionSet.argtypes = [c_void_p, c_void_p]
+ale_lib.ALEVector_getMinimalActionSet.restype = None
+ale_lib.ALEVector_getMinimalActionSize.argtypes = [c_void_p]
+ale_lib.ALEVector_getMinimalActionSize.restype = c_int
+ale_lib.ALEVector_lastError.argtypes = None
+ale_lib.ALEVector_lastError.restype = c_char_p
 
 def _as_bytes(s):
     if hasattr(s, 'encode'):
         return s.encode('utf8')
     return s
 
+def _check_vector(result):
+    # The vectorized calls return -1 instead of letting C++ exceptions escape
+    if result < 0:
+        raise RuntimeError(ale_lib.ALEVector_lastError().decode('utf8'))
+    return result
+
+class _ALEStepResult(Structure):
+    _fields_ = [('reward', c_int),
+                ('terminal', c_bool),
+                ('lives', c_int),
+                ('frame_number', c_int),
+                ('episode_frame_number', c_int)]
+
+StepResult = namedtuple('StepResult', ['reward', 'terminal', 'lives', 'frame_number',
+                                       'episode_frame_number', 'obs', 'ram'])
+
 class ALEInterface(object):
     # Logger enum
     class Logger:
@@ -108,8 +208,42 @@ class ALEInterface(object):
         Warning = 1
         Error = 2
 
+    # Observation types for step()
+    _OBS_TYPES = {None: 0, 'raw': 1, 'rgb': 2, 'grayscale': 3, 'observation': 4,
+                  'rgba': 5, 'chw': 6}
+
     def __init__(self):
         self.obj = ale_lib.ALE_new()
+        self._step_result = _ALEStepResult()
+
+    @classmethod
+    def fromMemory(cls, rom, rom_name, settings=None):
+        """Returns an interface playing the ROM given as bytes, without
+        reading any file: no configuration, no ROM and no properties.
+        rom_name is the name the ROM file would have (e.g. 'pong.bin'),
+        by which the game is recognized. settings maps setting names to
+        their values; they must be known settings.
+        """
+        config = ale_lib.ALEConfig_new()
+        try:
+            for key, value in (settings or {}).items():
+                if isinstance(value, bool):
+                    ale_lib.ALEConfig_setBool(config, _as_bytes(key), value)
+                elif isinstance(value, six.integer_types):
+                    ale_lib.ALEConfig_setInt(config, _as_bytes(key), value)
+                elif isinstance(value, float):
+                    ale_lib.ALEConfig_setFloat(config, _as_bytes(key), value)
+                else:
+                    ale_lib.ALEConfig_setString(config, _as_bytes(key),
+                                                _as_bytes(value))
+            rom = bytes(rom)
+            obj = cls.__new__(cls)
+            obj.obj = ale_lib.ALE_newFromMemory(config, rom, len(rom),
+                                                _as_bytes(rom_name))
+            obj._step_result = _ALEStepResult()
+            return obj
+        finally:
+            ale_lib.ALEConfig_del(config)
 
     def getString(self, key):
         return ale_lib.getString(self.obj, _as_bytes(key))
@@ -138,6 +272,40 @@ class ALEInterface(object):
     def game_over(self):
         return ale_lib.game_over(self.obj)
 
+    def step(self, action, obs_type='rgb', obs=None, ram=None):
+        """Applies action and gathers its outcome in a single call into the
+        library, instead of separate act(), game_over(), lives() and screen
+        calls. Returns a StepResult holding the reward, terminal flag, lives,
+        frame numbers, observation and RAM.
+        obs_type is 'raw', 'rgb' (as getScreenRGB2), 'rgba', 'chw', 'grayscale',
+        'observation' (as getObservation) or None for no observation. obs is
+        filled in if given, and allocated otherwise.
+        ram, if given, is filled with the RAM; otherwise the RAM is skipped.
+        Arrays passed in must be C-contiguous uint8 arrays of the right size.
+        """
+        if obs is None and obs_type is not None:
+            width = ale_lib.getScreenWidth(self.obj)
+            height = ale_lib.getScreenHeight(self.obj)
+            if obs_type == 'observation':
+                obs = np.empty(self._observationShape(), dtype=np.uint8)
+            elif obs_type == 'raw':
+                obs = np.empty((height, width), dtype=np.uint8)
+            elif obs_type == 'rgb':
+                obs = np.empty((height, width, 3), dtype=np.uint8)
+            elif obs_type == 'rgba':
+                obs = np.empty((height, width, 4), dtype=np.uint8)
+            elif obs_type == 'chw':
+                obs = np.empty((3, height, width), dtype=np.uint8)
+            else:
+                obs = np.empty((height, width, 1), dtype=np.uint8)
+        # Raw data pointers are cheaper to pass than as_ctypes() arrays
+        result = self._step_result
+        ale_lib.step(self.obj, int(action), byref(result), self._OBS_TYPES[obs_type],
+                     None if obs is None else obs.ctypes.data,
+                     None if ram is None else ram.ctypes.data)
+        return StepResult(result.reward, result.terminal, result.lives, result.frame_number,
+                          result.episode_frame_number, obs, ram)
+
     def reset_game(self):
         ale_lib.reset_game(self.obj)
 
@@ -221,6 +389,32 @@ class ALEInterface(object):
         ale_lib.getScreenRGB2(self.obj, as_ctypes(screen_data[:]))
         return screen_data
 
+    def getScreenRGBA(self, screen_data=None):
+        """This function fills screen_data with the data in RGBA format, with
+        an opaque alpha channel: screen_data[y, x, :] is [red, green, blue, 255].
+        screen_data MUST be a C-contiguous numpy array of uint8 of shape
+        (height, width, 4). If it is None, then this function will initialize it.
+        """
+        if(screen_data is None):
+            width = ale_lib.getScreenWidth(self.obj)
+            height = ale_lib.getScreenHeight(self.obj)
+            screen_data = np.empty((height, width, 4), dtype=np.uint8)
+        ale_lib.getScreenRGBA(self.obj, screen_data.ctypes.data)
+        return screen_data
+
+    def getScreenCHW(self, screen_data=None):
+        """This function fills screen_data with the data in planar RGB format:
+        screen_data[c, y, x] is channel c (red, green, blue) of pixel (x, y).
+        screen_data MUST be a C-contiguous numpy array of uint8 of shape
+        (3, height, width). If it is None, then this function will initialize it.
+        """
+        if(screen_data is None):
+            width = ale_lib.getScreenWidth(self.obj)
+            height = ale_lib.getScreenHeight(self.obj)
+            screen_data = np.empty((3, height, width), dtype=np.uint8)
+        ale_lib.getScreenCHW(self.obj, screen_data.ctypes.data)
+        return screen_data
+
     def getScreenGrayscale(self, screen_data=None):
         """This function fills screen_data with the data in grayscale
         screen_data MUST be a numpy array of uint8. This can be initialized like so:
@@ -234,6 +428,23 @@ class ALEInterface(object):
         ale_lib.getScreenGrayscale(self.obj, as_ctypes(screen_data[:]))
         return screen_data
 
+    def getObservation(self, obs=None):
+        """Returns the preprocessed observation, a stack of downsampled
+        grayscale frames with the oldest frame first, in an array of shape
+        (observation_stack, observation_height, observation_width). Requires
+        preprocess_observations to be set before loading the ROM.
+        If obs is None, then this function will initialize it.
+        """
+        if obs is None:
+            obs = np.empty(self._observationShape(), dtype=np.uint8)
+        assert obs.size == ale_lib.getObservationSize(self.obj)
+        ale_lib.getObservation(self.obj, obs.ctypes.data)
+        return obs
+
+    def _observationShape(self):
+        return (self.getInt('observation_stack'), self.getInt('observation_height'),
+                self.getInt('observation_width'))
+
     def getRAMSize(self):
         return ale_lib.getRAMSize(self.obj)
 
@@ -250,6 +461,17 @@ class ALEInterface(object):
         ale_lib.getRAM(self.obj, as_ctypes(ram))
         return ram
 
+    def getRAMView(self):
+        """Returns a read-only uint8 array over the console RAM itself. It follows
+        the emulator without copying, and is only valid while this object lives
+        and until the next loadROM().
+        """
+        ram_size = ale_lib.getRAMSize(self.obj)
+        buf = (c_ubyte * ram_size).from_address(ale_lib.getRAMView(self.obj))
+        view = np.frombuffer(buf, dtype=np.uint8)
+        view.flags.writeable = False
+        return view
+
     def saveScreenPNG(self, filename):
         """Save the current screen as a png file"""
         return ale_lib.saveScreenPNG(self.obj, _as_bytes(filename))
@@ -262,11 +484,17 @@ class ALEInterface(object):
         """Loads the state of the system"""
         return ale_lib.loadState(self.obj)
 
-    def cloneState(self):
+    def cloneState(self, parent=None):
         """This makes a copy of the environment state. This copy does *not*
         include pseudorandomness, making it suitable for planning
         purposes. By contrast, see cloneSystemState.
+
+        If parent (a state from an earlier cloneState) is given, only
+        what differs from it is stored; the parent may be deleted
+        afterwards.
         """
+        if parent is not None:
+            return ale_lib.cloneDeltaState(self.obj, parent)
         return ale_lib.cloneState(self.obj)
 
     def restoreState(self, state):
@@ -288,6 +516,16 @@ class ALEInterface(object):
         """Reverse operation of cloneSystemState."""
         ale_lib.restoreSystemState(self.obj, state)
 
+    def clone(self):
+        """Returns a new interface in the same state as this one, with the
+        same settings and game, including pseudorandomness. Nothing is read
+        from disk.
+        """
+        other = self.__class__.__new__(self.__class__)
+        other.obj = ale_lib.ALE_clone(self.obj)
+        other._step_result = _ALEStepResult()
+        return other
+
     def deleteState(self, state):
         """ Deallocates the ALEState """
         ale_lib.deleteState(state)
@@ -305,6 +543,24 @@ class ALEInterface(object):
     def decodeState(self, serialized):
         return ale_lib.decodeState(as_ctypes(serialized), len(serialized))
 
+    def getProfile(self):
+        """Returns the time and calls spent in each phase of emulation, and
+        instruction, frame, clone and restore counts, as a dict. They are
+        only collected if the library was configured with USE_PROFILING;
+        'enabled' is False otherwise.
+        """
+        return json.loads(ale_lib.getProfileJSON(self.obj).decode('utf-8'))
+
+    def resetProfile(self):
+        ale_lib.resetProfile(self.obj)
+
+    def getMemoryUsage(self):
+        """Returns the bytes used by this interface per subsystem as a dict,
+        with their 'total'. 'shared' is the memory shared with the other
+        interfaces of the same ROM, and not part of the total.
+        """
+        return json.loads(ale_lib.getMemoryUsageJSON(self.obj).decode('utf-8'))
+
     def __del__(self):
         ale_lib.ALE_del(self.obj)
 
@@ -314,3 +570,122 @@ class ALEInterface(object):
         mode = dic.get(mode, mode)
         assert mode in [0, 1, 2], "Invalid Mode! Mode must be one of 0: info, 1: warning, 2: error"
         ale_lib.setLoggerMode(mode)
+
+
+class ALEVectorInterface(object):
+    """Runs num_envs copies of a game and steps them together on a pool of
+    num_threads native worker threads (0 means one per core). Observations
+    of all environments are returned in a single (num_envs, height, width)
+    uint8 array of raw palette indices.
+    """
+
+    def __init__(self, num_envs, num_threads=0):
+        self.obj = ale_lib.ALEVector_new(int(num_envs), int(num_threads))
+        self.num_envs = num_envs
+        self._slabs = None
+
+    def setString(self, key, value):
+      ale_lib.ALEVector_setString(self.obj, _as_bytes(key), _as_bytes(value))
+    def setInt(self, key, value):
+      ale_lib.ALEVector_setInt(self.obj, _as_bytes(key), int(value))
+    def setBool(self, key, value):
+      ale_lib.ALEVector_setBool(self.obj, _as_bytes(key), bool(value))
+    def setFloat(self, key, value):
+      ale_lib.ALEVector_setFloat(self.obj, _as_bytes(key), float(value))
+
+    def loadROM(self, rom_file):
+        """Loads the game in every environment. A non-zero random_seed s
+        gives environment i the seed s + i; with random_seed 0, s is drawn
+        at random.
+        """
+        _check_vector(ale_lib.ALEVector_loadROM(self.obj, _as_bytes(rom_file)))
+        self._slabs = [self._slab_views(b) for b in range(2)]
+
+    def numThreads(self):
+        return ale_lib.ALEVector_numThreads(self.obj)
+
+    def getScreenDims(self):
+        """returns a tuple that contains (screen_width, screen_height)
+        """
+        width = ale_lib.ALEVector_getScreenWidth(self.obj)
+        height = ale_lib.ALEVector_getScreenHeight(self.obj)
+        return (width, height)
+
+    def getMinimalActionSet(self):
+        act_size = ale_lib.ALEVector_getMinimalActionSize(self.obj)
+        act = np.zeros((act_size), dtype=np.intc)
+        ale_lib.ALEVector_getMinimalActionSet(self.obj, as_ctypes(act))
+        return act
+
+    def _screens(self, screens):
+        if screens is None:
+            width, height = self.getScreenDims()
+            screens = np.empty((self.num_envs, height, width), dtype=np.uint8)
+        return screens
+
+    def act_batch(self, actions, rewards=None, terminals=None, screens=None):
+        """Applies actions[i] to environment i and returns the tuple
+        (rewards, terminals, screens). Environments that reach a terminal
+        state are reset in the same call, so their screen is the first
+        frame of the next episode. Output arrays may be preallocated and
+        passed in to avoid allocations; they must be C-contiguous.
+        """
+        actions = np.ascontiguousarray(actions, dtype=np.intc)
+        assert actions.shape == (self.num_envs,)
+        if rewards is None:
+            rewards = np.empty(self.num_envs, dtype=np.intc)
+        if terminals is None:
+            terminals = np.empty(self.num_envs, dtype=np.bool_)
+        screens = self._screens(screens)
+        _check_vector(ale_lib.ALEVector_act_batch(self.obj, as_ctypes(actions),
+                                                  as_ctypes(rewards), as_ctypes(terminals),
+                                                  as_ctypes(screens)))
+        return rewards, terminals, screens
+
+    def reset_all(self, screens=None):
+        """Resets every environment and returns the starting screens."""
+        screens = self._screens(screens)
+        _check_vector(ale_lib.ALEVector_reset_all(self.obj, as_ctypes(screens)))
+        return screens
+
+    def _slab_views(self, slab):
+        n = self.num_envs
+        width, height = self.getScreenDims()
+        return (as_array(ale_lib.ALEVector_slabEnvIds(self.obj, slab), (n,)),
+                as_array(ale_lib.ALEVector_slabRewards(self.obj, slab), (n,)),
+                as_array(ale_lib.ALEVector_slabTerminals(self.obj, slab), (n,)),
+                as_array(ale_lib.ALEVector_slabScreens(self.obj, slab), (n, height, width)))
+
+    def send(self, actions, env_ids=None):
+        """Queues one step for each environment in env_ids (all environments
+        if None) and returns immediately. An environment may only have one
+        step in flight; collect it with recv() before sending to it again.
+        """
+        actions = np.ascontiguousarray(actions, dtype=np.intc)
+        if env_ids is None:
+            assert len(actions) <= self.num_envs
+            _check_vector(ale_lib.ALEVector_send(self.obj, as_ctypes(actions), None,
+                                                 len(actions)))
+        else:
+            env_ids = np.ascontiguousarray(env_ids, dtype=np.intc)
+            assert env_ids.shape == actions.shape
+            _check_vector(ale_lib.ALEVector_send(self.obj, as_ctypes(actions),
+                                                 as_ctypes(env_ids), len(actions)))
+
+    def recv(self, batch_size):
+        """Waits for the first batch_size environments to finish their step
+        and returns (env_ids, rewards, terminals, screens) for them, in
+        completion order. The arrays are views into one of two native
+        buffers that are used alternately: they are not copied, and stay
+        valid until the next-but-one call to recv().
+        """
+        slab = _check_vector(ale_lib.ALEVector_recv(self.obj, int(batch_size)))
+        return tuple(a[:batch_size] for a in self._slabs[slab])
+
+    def getScreens(self, screens=None):
+        screens = self._screens(screens)
+        ale_lib.ALEVector_getScreens(self.obj, as_ctypes(screens))
+        return screens
+
+    def __del__(self):
+        ale_lib.ALEVector_del(self.obj)
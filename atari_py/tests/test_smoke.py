@@ -1,5 +1,37 @@
 import atari_py
 import numpy as np
+import pytest
+
+def _configure(ale, settings):
+    for key, value in settings.items():
+        if isinstance(value, bool):
+            ale.setBool(key, value)
+        elif isinstance(value, int):
+            ale.setInt(key, value)
+        elif isinstance(value, float):
+            ale.setFloat(key, value)
+        else:
+            ale.setString(key, value)
+
+def _play(ale, steps=300):
+    """Takes the minimal set's actions in turn, resetting finished episodes, and
+    returns the reward, screen and RAM after every step and reset."""
+    action_set = ale.getMinimalActionSet()
+    results = []
+    for t in range(steps):
+        reward = ale.act(action_set[t % len(action_set)])
+        results.append((reward, ale.getScreen().tobytes(), ale.getRAM().tobytes()))
+        if ale.game_over():
+            ale.reset_game()
+            results.append((0, ale.getScreen().tobytes(), ale.getRAM().tobytes()))
+    return results
+
+def _trajectory(rom, steps=300, **settings):
+    """Plays the given game with random_seed 7 and the given settings; see _play()."""
+    ale = atari_py.ALEInterface()
+    _configure(ale, dict({'random_seed': 7}, **settings))
+    ale.loadROM(atari_py.get_game_path(rom))
+    return _play(ale, steps)
 
 def test_smoke():
     pong_path = atari_py.get_game_path('pong')
@@ -14,3 +46,353 @@ def test_smoke():
     (screen_width,screen_height) = ale.getScreenDims()
     arr = np.zeros((screen_height, screen_width, 4), dtype=np.uint8)
     ale.getScreenRGB(arr)
+
+def test_vector_smoke():
+    pong_path = atari_py.get_game_path('pong')
+    vec = atari_py.ALEVectorInterface(4, 2)
+    vec.loadROM(pong_path)
+    action_set = vec.getMinimalActionSet()
+
+    # Test batched stepping
+    (screen_width,screen_height) = vec.getScreenDims()
+    screens = vec.reset_all()
+    assert screens.shape == (4, screen_height, screen_width)
+    rewards, terminals, screens = vec.act_batch([action_set[0]] * 4)
+    assert rewards.shape == (4,) and terminals.shape == (4,)
+
+    # Test asynchronous stepping
+    vec.send([action_set[0]] * 4)
+    env_ids, rewards, terminals, screens = vec.recv(2)
+    assert screens.shape == (2, screen_height, screen_width)
+    vec.send([action_set[0]] * 2, env_ids)
+    vec.recv(4)
+
+def test_vector_errors(tmp_path):
+    vec = atari_py.ALEVectorInterface(2, 2)
+    assert vec.getScreenDims() == (0, 0)
+
+    # Native errors are raised in Python instead of aborting the process
+    rom = tmp_path / 'unknown.bin'
+    rom.write_bytes(b'\0' * 4096)
+    with pytest.raises(RuntimeError):
+        vec.loadROM(str(rom))
+
+    vec.loadROM(atari_py.get_game_path('pong'))
+    vec.send([0, 0])
+    with pytest.raises(RuntimeError):
+        vec.send([0], [1])
+    with pytest.raises(RuntimeError):
+        vec.act_batch([0, 0])
+    with pytest.raises(RuntimeError):
+        vec.recv(3)
+    env_ids, _, _, _ = vec.recv(2)
+    assert sorted(env_ids) == [0, 1]
+
+def test_reset_cache():
+    # Enough short episodes for resets to repeat the same RIOT start timer
+    def run(reset_cache):
+        return _trajectory('pong', steps=2000, max_num_frames_per_episode=10,
+                           reset_cache=reset_cache)
+
+    assert run(True) == run(False)
+
+def test_compact_state():
+    def rollout(compact):
+        ale = atari_py.ALEInterface()
+        # restoreState() leaves the RNG alone, so random action repeats would differ
+        ale.setInt('random_seed', 7)
+        ale.setFloat('repeat_action_probability', 0.0)
+        ale.setBool('compact_state', compact)
+        ale.loadROM(atari_py.get_game_path('pong'))
+        action_set = ale.getMinimalActionSet()
+        for t in range(100):
+            ale.act(action_set[t % len(action_set)])
+        state = ale.cloneState()
+        first = [ale.act(action_set[t % len(action_set)]) for t in range(50)]
+        first_screen = ale.getScreen().tobytes()
+        ale.restoreState(state)
+        second = [ale.act(action_set[t % len(action_set)]) for t in range(50)]
+        assert first == second and ale.getScreen().tobytes() == first_screen
+        return first_screen
+
+    assert rollout(True) == rollout(False)
+
+def test_restore_state(tmp_path):
+    # A 4K ROM that never strobes VSYNC, so the TIA ends each frame at the first
+    # write past its scanline limit: a RESP0 in the middle of a visible
+    # scanline. The first copy of player 0 stays suppressed for the rest of that
+    # line, which the registers alone don't tell.
+    loop = 0xF011
+    code = bytes([0x78, 0xD8, 0xA2, 0xFF, 0x9A,  # SEI; CLD; LDX #$FF; TXS
+                  0xA9, 0x00, 0x85, 0x04,        # NUSIZ0 = 0
+                  0xA9, 0xFF, 0x85, 0x1B,        # GRP0 = $FF
+                  0xA9, 0x0E, 0x85, 0x06,        # COLUP0 = $0E
+                  0xA0, 0x12, 0xA2, 0x00,        # loop: LDY #18; LDX #0
+                  0xCA, 0xD0, 0xFD,              # DEX; BNE *-1
+                  0x88, 0xD0, 0xFA,              # DEY; BNE *-4
+                  0x85, 0x10,                    # STA RESP0
+                  0x4C, loop & 0xFF, loop >> 8]) # JMP loop
+    rom = bytearray(4096)
+    rom[:len(code)] = code
+    rom[0xFFC:] = b'\x00\xF0\x00\xF0'            # reset and break vectors
+    # Game settings are picked by file name; Pong's only read the RAM
+    path = tmp_path / 'pong.bin'
+    path.write_bytes(bytes(rom))
+
+    reference, restored = atari_py.ALEInterface(), atari_py.ALEInterface()
+    for ale in (reference, restored):
+        _configure(ale, {'random_seed': 7, 'repeat_action_probability': 0.0})
+        ale.loadROM(str(path))
+    for t in range(60):
+        # Restore mid-scanline into an interface that has drawn another frame
+        restored.act(0)
+        restored.restoreState(reference.cloneState())
+        reference.act(0)
+        restored.act(0)
+        assert reference.getScreen().tobytes() == restored.getScreen().tobytes()
+
+def test_delta_state():
+    ale = atari_py.ALEInterface()
+    ale.loadROM(atari_py.get_game_path('pong'))
+    action_set = ale.getMinimalActionSet()
+
+    parent = ale.cloneState()
+    for t in range(20):
+        ale.act(action_set[t % len(action_set)])
+    full = ale.cloneState()
+    delta = ale.cloneState(parent)
+    # The delta keeps its own reference to the parent's data
+    ale.deleteState(parent)
+    assert (ale.encodeState(delta) == ale.encodeState(full)).all()
+
+    screens = []
+    for state in (full, delta):
+        ale.restoreState(state)
+        ale.act(action_set[1])
+        screens.append(ale.getScreen().tobytes())
+    assert screens[0] == screens[1]
+
+def test_step():
+    fused, separate = atari_py.ALEInterface(), atari_py.ALEInterface()
+    for ale in (fused, separate):
+        # Same seed, so that both repeat the same actions
+        ale.setInt('random_seed', 7)
+        ale.loadROM(atari_py.get_game_path('breakout'))
+    action_set = fused.getMinimalActionSet()
+
+    obs = np.empty((210, 160, 3), dtype=np.uint8)
+    ram = np.empty(fused.getRAMSize(), dtype=np.uint8)
+    for t in range(200):
+        action = action_set[t % len(action_set)]
+        result = fused.step(action, 'rgb', obs, ram)
+        assert result.reward == separate.act(action)
+        assert result.terminal == separate.game_over()
+        assert result.lives == separate.lives()
+        assert result.frame_number == separate.getFrameNumber()
+        assert (result.obs == separate.getScreenRGB2()).all()
+        assert (result.ram == separate.getRAM()).all()
+
+def test_observation_pipeline():
+    pipeline, reference = atari_py.ALEInterface(), atari_py.ALEInterface()
+    pipeline.setBool('preprocess_observations', True)
+    # Halving both axes makes the downsampling a plain 2x2 average
+    pipeline.setInt('observation_width', 80)
+    pipeline.setInt('observation_height', 105)
+    pipeline.setInt('frame_skip', 4)
+    for ale in (pipeline, reference):
+        ale.setFloat('repeat_action_probability', 0.0)
+        ale.loadROM(atari_py.get_game_path('breakout'))
+    action_set = pipeline.getMinimalActionSet()
+
+    def downsample(frame):
+        return frame.astype(np.float64).reshape(105, 2, 80, 2).mean(axis=(1, 3))
+
+    expected = [downsample(reference.getScreenGrayscale()[:, :, 0])] * 4
+    for t in range(50):
+        action = action_set[t % len(action_set)]
+        obs = pipeline.step(action, 'observation').obs
+        frames = []
+        for k in range(4):
+            reference.act(action)
+            frames.append(reference.getScreenGrayscale()[:, :, 0])
+        expected = expected[1:] + [downsample(np.maximum(frames[2], frames[3]))]
+        assert obs.shape == (4, 105, 80)
+        assert np.abs(obs - np.array(expected)).max() <= 0.5
+
+def test_screen_layouts():
+    ale = atari_py.ALEInterface()
+    ale.loadROM(atari_py.get_game_path('pong'))
+    for t in range(100):
+        ale.act(0)
+    rgb = ale.getScreenRGB2()
+    rgba = ale.getScreenRGBA()
+    assert (rgba[:, :, :3] == rgb).all() and (rgba[:, :, 3] == 255).all()
+    assert (ale.getScreenCHW().transpose(1, 2, 0) == rgb).all()
+
+def test_render_skip():
+    def run(render_skip):
+        # Episodes that end in the middle of an act exercise the replay of skipped frames
+        return _trajectory('breakout', steps=600, frame_skip=4, max_num_frames_per_episode=1001,
+                           color_averaging=True, render_skip=render_skip)
+
+    assert run(True) == run(False)
+
+def test_ram_view():
+    ale = atari_py.ALEInterface()
+    ale.loadROM(atari_py.get_game_path('breakout'))
+    view = ale.getRAMView()
+    assert not view.flags.writeable
+    for t in range(50):
+        ale.act(t % 4)
+        assert (view == ale.getRAM()).all()
+
+def test_profile():
+    ale = atari_py.ALEInterface()
+    ale.loadROM(atari_py.get_game_path('pong'))
+    ale.resetProfile()
+    for t in range(10):
+        ale.act(0)
+    profile = ale.getProfile()
+    assert set(profile['phases']) >= {'cpu', 'tia_update', 'rom_step', 'palette'}
+    if profile['enabled']:
+        assert profile['counts']['frames'] == 10
+        assert profile['phases']['cpu']['calls'] == 10
+        assert profile['counts']['instructions'] > 0
+
+def test_fast_cpu():
+    # A 4K cartridge and a bank switched one
+    for game in ('seaquest', 'robotank'):
+        assert _trajectory(game, cpu='fast') == _trajectory(game, cpu='high')
+
+def test_block_cpu():
+    # Bank switched, so blocks are dropped and revalidated as banks change
+    assert _trajectory('ms_pacman', cpu='block') == _trajectory('ms_pacman', cpu='high')
+
+def test_block_cpu_ram_code(tmp_path):
+    # An 8K Superchip ROM that rewrites a routine in cartridge RAM, through the
+    # write port, before each call through the read port. The routine sets the
+    # background colour of a scanline; a stale copy of it would repeat one.
+    loop = 0xF119
+    code = bytes([0x78, 0xD8, 0xA2, 0xFF, 0x9A,  # SEI; CLD; LDX #$FF; TXS
+                  0xA9, 0xA9, 0x8D, 0x00, 0xF0,  # RAM: LDA #
+                  0xA9, 0x85, 0x8D, 0x02, 0xF0,  #      STA
+                  0xA9, 0x09, 0x8D, 0x03, 0xF0,  #      COLUBK
+                  0xA9, 0x60, 0x8D, 0x04, 0xF0,  #      RTS
+                  0xE6, 0x80,                    # loop: INC $80
+                  0xA5, 0x80, 0x8D, 0x01, 0xF0,  # LDA $80; STA the LDA operand
+                  0x20, 0x80, 0xF0,              # JSR the routine
+                  0x85, 0x02,                    # STA WSYNC
+                  0x4C, loop & 0xFF, loop >> 8]) # JMP loop
+    rom = bytearray(8192)
+    rom[0x1100:0x1100 + len(code)] = code
+    rom[0x1FFC:] = b'\x00\xF1\x00\xF1'         # reset and break vectors
+    path = tmp_path / 'pong.bin'
+    path.write_bytes(bytes(rom))
+
+    screens = {}
+    for cpu in ('high', 'block'):
+        ale = atari_py.ALEInterface()
+        _configure(ale, {'random_seed': 7, 'cpu': cpu})
+        ale.loadROM(str(path))
+        screens[cpu] = []
+        for t in range(10):
+            ale.act(0)
+            screens[cpu].append(ale.getScreen().tobytes())
+    assert len(set(screens['high'][-1])) > 1
+    assert screens['block'] == screens['high']
+
+def test_vector_tia_update():
+    # Collisions drive the game, so they show up in the RAM
+    assert (_trajectory('space_invaders', vector_tia_update=True) ==
+            _trajectory('space_invaders', vector_tia_update=False))
+
+def test_shared_rom(tmp_path):
+    first = atari_py.ALEInterface()
+    first.setInt('random_seed', 7)
+    first.loadROM(atari_py.get_game_path('enduro'))
+    assert first.getMemoryUsage()['shared'] == 0
+
+    # The second interface shares the ROM image the first one read
+    second = atari_py.ALEInterface()
+    second.setInt('random_seed', 7)
+    second.loadROM(atari_py.get_game_path('enduro'))
+    shared = first.getMemoryUsage()['shared']
+    assert shared > 0 and second.getMemoryUsage()['shared'] == shared
+    assert _play(first) == _play(second)
+
+    # A ROM file rewritten with other contents of the same size isn't shared
+    path = tmp_path / 'pong.bin'
+    with open(atari_py.get_game_path('pong'), 'rb') as f:
+        rom = f.read()
+    path.write_bytes(rom)
+    third = atari_py.ALEInterface()
+    third.loadROM(str(path))
+    path.write_bytes(rom[::-1])
+    fourth = atari_py.ALEInterface()
+    fourth.loadROM(str(path))
+    assert third.getMemoryUsage()['shared'] == 0
+    assert fourth.getMemoryUsage()['shared'] == 0
+
+def test_clone():
+    ale = atari_py.ALEInterface()
+    _configure(ale, {'random_seed': 7, 'repeat_action_probability': 0.25})
+    ale.loadROM(atari_py.get_game_path('seaquest'))
+    _play(ale, 100)
+
+    # The clone carries on exactly as the original, random action repeats included
+    clone = ale.clone()
+    assert (clone.getScreen() == ale.getScreen()).all()
+    assert clone.getFrameNumber() == ale.getFrameNumber()
+    expected = _play(ale, 200)
+    del ale
+    assert _play(clone, 200) == expected
+
+def test_from_memory():
+    path = atari_py.get_game_path('seaquest')
+    with open(path, 'rb') as f:
+        rom = f.read()
+    expected = _trajectory('seaquest', steps=200, repeat_action_probability=0.25)
+
+    # The game is recognized by name, and plays as if it were read from its file
+    ale = atari_py.ALEInterface.fromMemory(
+        rom, 'seaquest.bin',
+        {'random_seed': 7, 'repeat_action_probability': 0.25})
+    assert _play(ale, 200) == expected
+
+def test_settings():
+    ale = atari_py.ALEInterface()
+    ale.setInt('frame_skip', 3)
+    ale.setInt('max_num_frames_per_episode', 30)
+    ale.setBool('color_averaging', True)
+    ale.setFloat('repeat_action_probability', 0.0)
+    assert ale.getInt('frame_skip') == 3
+    assert ale.getBool('color_averaging')
+    ale.loadROM(atari_py.get_game_path('pong'))
+    action_set = ale.getMinimalActionSet()
+
+    # Each act() plays frame_skip frames, until the episode is cut short
+    ale.act(action_set[0])
+    assert ale.getEpisodeFrameNumber() == 3
+    while not ale.game_over():
+        ale.act(action_set[0])
+    assert ale.getEpisodeFrameNumber() == 30
+
+def test_memory_usage():
+    ale = atari_py.ALEInterface()
+    ale.setInt('random_seed', 1)
+    ale.loadROM(atari_py.get_game_path('pong'))
+    usage = ale.getMemoryUsage()
+    subsystems = [key for key in usage if key not in ('total', 'shared')]
+    assert usage['total'] == sum(usage[key] for key in subsystems)
+    assert usage['tia'] > 2 * 160 * 210
+
+    # The compact screen views the frame buffer and shows the same pixels
+    compact = atari_py.ALEInterface()
+    compact.setInt('random_seed', 1)
+    compact.setBool('compact_memory', True)
+    compact.loadROM(atari_py.get_game_path('pong'))
+    for _ in range(100):
+        ale.act(0)
+        compact.act(0)
+    np.testing.assert_array_equal(ale.getScreen(), compact.getScreen())
+    assert compact.getMemoryUsage()['environment'] <= usage['environment'] - 160 * 210
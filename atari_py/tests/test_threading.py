@@ -0,0 +1,42 @@
+import atari_py
+import numpy as np
+import threading
+
+NUM_THREADS = 8
+NUM_STEPS = 400
+# Covers cartridges with and without on-board RAM
+GAMES = ['pong', 'breakout', 'elevator_action', 'montezuma_revenge']
+
+
+def _trajectory(index):
+    ale = atari_py.ALEInterface()
+    ale.setInt('random_seed', 100 + index)
+    ale.setFloat('repeat_action_probability', 0.25)
+    ale.loadROM(atari_py.get_game_path(GAMES[index % len(GAMES)]))
+    action_set = ale.getMinimalActionSet()
+
+    trajectory = []
+    for t in range(NUM_STEPS):
+        reward = ale.act(action_set[(t * 7 + index) % len(action_set)])
+        trajectory.append((reward, ale.getRAM().tobytes(), ale.getScreen().tobytes()))
+        if ale.game_over():
+            ale.reset_game()
+    return trajectory
+
+
+def test_concurrent_instances_match_single_threaded():
+    expected = [_trajectory(i) for i in range(NUM_THREADS)]
+
+    # ctypes releases the GIL during calls, so the emulators really do run
+    # concurrently here
+    results = [None] * NUM_THREADS
+    def worker(i):
+        results[i] = _trajectory(i)
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(NUM_THREADS)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for i in range(NUM_THREADS):
+        assert results[i] == expected[i], 'trajectory %d differs when run on a thread' % i